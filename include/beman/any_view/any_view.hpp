@@ -7,8 +7,29 @@
 #include <beman/any_view/detail/iterator.hpp>
 #include <beman/any_view/detail/lifetimebound.hpp>
 #include <beman/any_view/detail/polymorphic_view.hpp>
+#include <beman/any_view/detail/shared_view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <optional>
 
 namespace beman::any_view {
+namespace detail {
+
+struct any_view_access;
+
+template <class AnyViewT>
+class converted_view;
+
+template <class T>
+inline constexpr bool is_any_view = false;
+
+// another any_view is fetched from in batches rather than nested as is, unless it must be iterated backwards
+template <class ViewT, class RefT, class RValueRefT, class DiffT, any_view_options OptsV>
+concept flattenable_view = is_any_view<ViewT> and (not flag_is_set<OptsV, any_view_options::bidirectional>) and
+                           ext_any_compatible_range<converted_view<ViewT>, RefT, RValueRefT, DiffT, OptsV>;
+
+} // namespace detail
 
 template <class ElementT,
           any_view_options OptsV = any_view_options::input,
@@ -25,19 +46,26 @@ class any_view : public std::ranges::view_interface<any_view<ElementT, OptsV, Re
               class OtherDiffT>
     friend class any_view;
 
+    friend struct detail::any_view_access;
+
+    static constexpr bool random_access       = detail::flag_is_set<OptsV, any_view_options::random_access>;
     static constexpr bool approximately_sized = detail::flag_is_set<OptsV, any_view_options::approximately_sized>;
     static constexpr bool sized               = detail::flag_is_set<OptsV, any_view_options::sized>;
     static constexpr bool contiguous_and_sized =
         detail::flag_is_set<OptsV, any_view_options::contiguous | any_view_options::sized>;
-    static constexpr bool copyable = detail::flag_is_set<OptsV, any_view_options::copyable>;
+    static constexpr bool reversible = detail::flag_is_set<OptsV, any_view_options::bidirectional> and
+                                       not detail::flag_is_set<OptsV, any_view_options::contiguous>;
+    static constexpr bool copyable   = detail::flag_is_set<OptsV, any_view_options::copyable>;
+    static constexpr bool shared     = detail::flag_is_set<OptsV, any_view_options::shared>;
 
     using uncounted_iterator = detail::iterator<ElementT, RefT, RValueRefT, DiffT, OptsV>;
     using iterator =
         std::conditional_t<contiguous_and_sized, std::counted_iterator<std::add_pointer_t<RefT>>, uncounted_iterator>;
-    using value_type       = std::remove_cv_t<ElementT>;
-    using polymorphic_type = detail::polymorphic_view<value_type, RefT, RValueRefT, DiffT, OptsV>;
-    using sentinel         = std::default_sentinel_t;
-    using size_type        = std::make_unsigned_t<DiffT>;
+    using value_type                = std::remove_cv_t<ElementT>;
+    using polymorphic_type          = detail::polymorphic_view<value_type, RefT, RValueRefT, DiffT, OptsV>;
+    using polymorphic_iterator_type = detail::polymorphic_iterator<RefT, RValueRefT, DiffT, OptsV>;
+    using sentinel                  = std::default_sentinel_t;
+    using size_type                 = std::make_unsigned_t<DiffT>;
 
     template <detail::protocol ProtocolT>
     static constexpr auto dispatch = detail::dispatch<ProtocolT, polymorphic_type>;
@@ -45,6 +73,29 @@ class any_view : public std::ranges::view_interface<any_view<ElementT, OptsV, Re
     template <std::ranges::view ViewT>
     using adaptor_for = detail::view_adaptor<ViewT, OptsV>;
 
+    // shared views are erased behind a reference count, so that copies are O(1)
+    template <class RangeT, class AllocatorT = std::allocator<std::byte>>
+    [[nodiscard]] static constexpr auto make_adaptor(RangeT&& range, const AllocatorT& allocator = AllocatorT()) {
+        using view_type = std::views::all_t<RangeT>;
+
+        if constexpr (shared) {
+            constexpr bool const_iterable = ext_any_compatible_range<const view_type&, RefT, RValueRefT, DiffT, OptsV>;
+            static_assert(const_iterable or detail::clonable_view<view_type>,
+                          "range must be convertible to clonable view if any_view is shared and iterated as mutable");
+
+            using shared_view_type = detail::shared_view<view_type, const_iterable, AllocatorT>;
+            return adaptor_for<shared_view_type>{
+                .view = shared_view_type(std::views::all(std::forward<RangeT>(range)), allocator),
+            };
+        } else if constexpr (detail::flattenable_view<view_type, RefT, RValueRefT, DiffT, OptsV>) {
+            return adaptor_for<detail::converted_view<view_type>>{
+                .view = detail::converted_view<view_type>(std::forward<RangeT>(range)),
+            };
+        } else {
+            return adaptor_for<view_type>{.view = std::views::all(std::forward<RangeT>(range))};
+        }
+    }
+
     static constexpr polymorphic_type make_default() noexcept {
         return polymorphic_type(
             std::in_place_type<adaptor_for<detail::default_view<ElementT, RefT, RValueRefT, DiffT>>>);
@@ -59,7 +110,7 @@ class any_view : public std::ranges::view_interface<any_view<ElementT, OptsV, Re
     // type erase
     template <class RangeT, class InPlaceTypeT>
     constexpr any_view(RangeT&& range, InPlaceTypeT)
-        : poly(adaptor_for<std::views::all_t<RangeT>>{.view = std::views::all(std::forward<RangeT>(range))}) {}
+        : poly(make_adaptor(std::forward<RangeT>(range))) {}
 
     // upcast
     template <class RangeT, class OtherElementT, any_view_options OtherOptsV>
@@ -108,7 +159,9 @@ class any_view : public std::ranges::view_interface<any_view<ElementT, OptsV, Re
 
     // const_cast
     template <class RangeT, class OtherElementT, any_view_options OtherOptsV, class OtherRefT, class OtherRValueRefT>
-        requires detail::const_convertible<std::remove_cv_t<OtherElementT>, OtherRefT, OtherRValueRefT>
+        requires detail::const_convertible<std::remove_cv_t<OtherElementT>, OtherRefT, OtherRValueRefT> and
+                 std::same_as<RefT, detail::const_reference_t<std::remove_cv_t<OtherElementT>, OtherRefT>> and
+                 std::same_as<RValueRefT, detail::const_reference_t<std::remove_cv_t<OtherElementT>, OtherRValueRefT>>
     constexpr any_view(
         RangeT&& range,
         std::in_place_type_t<any_view<OtherElementT,
@@ -118,6 +171,58 @@ class any_view : public std::ranges::view_interface<any_view<ElementT, OptsV, Re
                                       DiffT>>) noexcept(noexcept(polymorphic_type(std::forward<RangeT>(range))))
         : poly(std::forward<RangeT>(range)) {}
 
+    using iterator_protocol_type = detail::iterator_witness_t<RefT, RValueRefT, DiffT>;
+
+    [[nodiscard]] constexpr auto iterator_witness() const {
+        return static_cast<const witness_for<iterator_protocol_type, detail::iterator_storage>*>(
+            dispatch<iterator_protocol_type>(poly));
+    }
+
+    [[nodiscard]] constexpr polymorphic_iterator_type begin_polymorphic() {
+        return polymorphic_iterator_type{[this] { return dispatch<detail::begin_t>(poly); }, iterator_witness()};
+    }
+
+    constexpr explicit any_view(polymorphic_type&& poly) noexcept : poly(std::move(poly)) {}
+
+    using pushdown_protocol_type =
+        decltype(detail::get_copyable_protocol<value_type, RefT, RValueRefT, DiffT, OptsV>());
+    using sized_witness_type =
+        detail::witness<decltype(detail::get_sized_protocol<DiffT, OptsV>()), detail::view_storage>;
+
+    // makes a view with the same type from the view that get_storage pushes the adaptor down into
+    template <class WitnessProtocolT, class GetStorageT>
+    [[nodiscard]] constexpr any_view pushdown(GetStorageT get_storage) {
+        const auto witnesses = dispatch<WitnessProtocolT>(poly);
+        return any_view(polymorphic_type(
+            get_storage,
+            static_cast<const witness_for<WitnessProtocolT, detail::view_storage>*>(witnesses.witness_ptr),
+            static_cast<const sized_witness_type*>(witnesses.sized_witness_ptr)));
+    }
+
+    [[nodiscard]] constexpr any_view slice(DiffT first, DiffT last)
+        requires random_access and sized
+    {
+        return pushdown<typename pushdown_protocol_type::slice_witness_type>(
+            [&] { return dispatch<detail::slice_t<DiffT>>(poly, first, last); });
+    }
+
+    [[nodiscard]] constexpr any_view take(DiffT count) && {
+        return pushdown<typename pushdown_protocol_type::window_witness_type>(
+            [&] { return dispatch<detail::take_t<DiffT>>(poly, count); });
+    }
+
+    [[nodiscard]] constexpr any_view drop(DiffT count) && {
+        return pushdown<typename pushdown_protocol_type::window_witness_type>(
+            [&] { return dispatch<detail::drop_t<DiffT>>(poly, count); });
+    }
+
+    [[nodiscard]] constexpr any_view reverse() &&
+        requires reversible
+    {
+        return pushdown<typename pushdown_protocol_type::reverse_witness_type>(
+            [&] { return dispatch<detail::reverse_t>(poly); });
+    }
+
   public:
     // [range.any.ctor]
     template <class RangeT>
@@ -127,7 +232,22 @@ class any_view : public std::ranges::view_interface<any_view<ElementT, OptsV, Re
                                                                   std::in_place_type<std::remove_cvref_t<RangeT>>)))
         : any_view(std::forward<RangeT>(range), std::in_place_type<std::remove_cvref_t<RangeT>>) {
         static_assert(std::ranges::viewable_range<RangeT>, "range must be viewable");
-        if constexpr (copyable) {
+        if constexpr (copyable and not shared) {
+            static_assert(std::copyable<std::views::all_t<RangeT>>,
+                          "range must be convertible to copyable view if any_view is copyable");
+        }
+    }
+
+    // the view and its iterators are allocated with allocator whenever they do not fit inplace
+    template <class AllocatorT, class RangeT>
+        requires ext_any_compatible_range<RangeT, RefT, RValueRefT, DiffT, OptsV>
+    constexpr any_view(std::allocator_arg_t, const AllocatorT& allocator, RangeT&& range)
+        : poly(detail::allocated_adaptor<decltype(make_adaptor(std::forward<RangeT>(range), allocator)), AllocatorT>{
+              make_adaptor(std::forward<RangeT>(range), allocator),
+              allocator,
+          }) {
+        static_assert(std::ranges::viewable_range<RangeT>, "range must be viewable");
+        if constexpr (copyable and not shared) {
             static_assert(std::copyable<std::views::all_t<RangeT>>,
                           "range must be convertible to copyable view if any_view is copyable");
         }
@@ -138,9 +258,9 @@ class any_view : public std::ranges::view_interface<any_view<ElementT, OptsV, Re
         requires(not std::ranges::enable_view<std::remove_cv_t<RangeT>>) and
                 ext_any_compatible_range<RangeT&, RefT, RValueRefT, DiffT, OptsV>
     constexpr any_view(BEMAN_ANY_VIEW_LIFETIMEBOUND RangeT& range)
-        : poly(adaptor_for<std::views::all_t<RangeT&>>{.view = std::views::all(range)}) {
+        : poly(make_adaptor(range)) {
         static_assert(std::ranges::viewable_range<RangeT&>, "range must be viewable");
-        if constexpr (copyable) {
+        if constexpr (copyable and not shared) {
             static_assert(std::copyable<std::views::all_t<RangeT&>>,
                           "range must be convertible to copyable view if any_view is copyable");
         }
@@ -171,19 +291,14 @@ class any_view : public std::ranges::view_interface<any_view<ElementT, OptsV, Re
 
     // [range.any.access]
     [[nodiscard]] constexpr iterator begin() {
-        using protocol_type = detail::iterator_witness_t<RefT, RValueRefT, DiffT>;
-
-        const auto get_storage = [this] { return dispatch<detail::begin_t>(poly); };
-        const auto witness_ptr =
-            static_cast<const witness_for<protocol_type, detail::iterator_storage>*>(dispatch<protocol_type>(poly));
-
         if constexpr (contiguous_and_sized) {
             const auto to_address = &detail::witness<detail::cache_t<RefT>, detail::iterator_storage>::entry;
-            return iterator{(witness_ptr->*to_address)(get_storage()), static_cast<DiffT>(size())};
+            return iterator{(iterator_witness()->*to_address)(dispatch<detail::begin_t>(poly)),
+                            static_cast<DiffT>(size())};
+        } else if constexpr (sized) {
+            return iterator{[this] { return begin_polymorphic(); }, [this] { return size(); }};
         } else {
-            return iterator{[=] {
-                return detail::polymorphic_iterator<RefT, RValueRefT, DiffT, OptsV>{get_storage, witness_ptr};
-            }};
+            return iterator{[this] { return begin_polymorphic(); }};
         }
     }
 
@@ -207,8 +322,147 @@ class any_view : public std::ranges::view_interface<any_view<ElementT, OptsV, Re
     constexpr friend void swap(any_view& lhs, any_view& rhs) noexcept { return lhs.swap(rhs); }
 };
 
+namespace detail {
+
+// grants extensions outside of any_view access to its polymorphic view
+struct any_view_access {
+    template <class AnyViewT, class RangeT>
+    static auto make_adaptor(RangeT&& range) -> decltype(AnyViewT::make_adaptor(std::forward<RangeT>(range)));
+
+    template <class AnyViewT>
+    [[nodiscard]] static constexpr auto& polymorphic(AnyViewT& view) noexcept {
+        return view.poly;
+    }
+
+    template <class AnyViewT>
+    [[nodiscard]] static constexpr auto begin_polymorphic(AnyViewT& view) {
+        return view.begin_polymorphic();
+    }
+
+    template <class AnyViewT, class DiffT>
+    [[nodiscard]] static constexpr AnyViewT slice(AnyViewT& view, DiffT first, DiffT last) {
+        return view.slice(first, last);
+    }
+
+    template <class AnyViewT, class DiffT>
+    [[nodiscard]] static constexpr AnyViewT take(AnyViewT&& view, DiffT count) {
+        return std::move(view).take(count);
+    }
+
+    template <class AnyViewT, class DiffT>
+    [[nodiscard]] static constexpr AnyViewT drop(AnyViewT&& view, DiffT count) {
+        return std::move(view).drop(count);
+    }
+
+    template <class AnyViewT>
+    [[nodiscard]] static constexpr AnyViewT reverse(AnyViewT&& view) {
+        return std::move(view).reverse();
+    }
+};
+
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+inline constexpr bool is_any_view<any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>> = true;
+
+// view of an any_view of another type, whose elements are fetched in batches so that an any_view erasing it dispatches
+// to it once per batch rather than once per element
+template <class AnyViewT>
+class converted_view : public std::ranges::view_interface<converted_view<AnyViewT>> {
+    using reference        = std::ranges::range_reference_t<AnyViewT>;
+    using rvalue_reference = std::ranges::range_rvalue_reference_t<AnyViewT>;
+    using element          = batch_element<reference>;
+    using polymorphic_type = decltype(any_view_access::begin_polymorphic(std::declval<AnyViewT&>()));
+
+    static constexpr std::size_t batch_size = 16;
+
+    AnyViewT base;
+
+  public:
+    // batches always start from the first element, so that iterators at the same element are at the same index
+    class iterator {
+        std::optional<polymorphic_type>                    poly;
+        std::array<batch_element_t<reference>, batch_size> buffer{};
+        std::size_t                                        size  = 0;
+        std::size_t                                        index = 0;
+
+        constexpr void fill(bool advance) {
+            size  = dispatch<next_batch_t<reference>, polymorphic_type>(*poly, buffer.data(), batch_size, advance);
+            index = 0;
+        }
+
+      public:
+        using value_type      = std::ranges::range_value_t<AnyViewT>;
+        using difference_type = std::ranges::range_difference_t<AnyViewT>;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr explicit iterator(polymorphic_type&& poly) : poly(std::move(poly)) { fill(false); }
+
+        // a prvalue is stored by the iterator, and is only referred to as mutable from a const iterator
+        [[nodiscard]] constexpr typename element::reference operator*() const {
+            return element::load(const_cast<batch_element_t<reference>&>(buffer[index]));
+        }
+
+        [[nodiscard]] constexpr friend rvalue_reference iter_move(const iterator& self) {
+            return static_cast<rvalue_reference>(std::move(*self));
+        }
+
+        constexpr iterator& operator++() {
+            if (++index == size) {
+                fill(true);
+            }
+
+            return *this;
+        }
+
+        constexpr void operator++(int) { ++*this; }
+
+        [[nodiscard]] constexpr iterator operator++(int)
+            requires std::ranges::forward_range<AnyViewT>
+        {
+            auto other = *this;
+            ++*this;
+            return other;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const iterator& other) const
+            requires std::ranges::forward_range<AnyViewT>
+        {
+            if (not poly or not other.poly) {
+                return poly.has_value() == other.poly.has_value();
+            }
+
+            return index == other.index and dispatch<equality_compare_t, polymorphic_type>(*poly, *other.poly);
+        }
+
+        [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept { return size == 0; }
+    };
+
+    constexpr explicit converted_view(AnyViewT base) noexcept : base(std::move(base)) {}
+
+    [[nodiscard]] constexpr iterator begin() { return iterator{any_view_access::begin_polymorphic(base)}; }
+
+    [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    [[nodiscard]] constexpr auto size()
+        requires std::ranges::sized_range<AnyViewT>
+    {
+        return std::ranges::size(base);
+    }
+
+    [[nodiscard]] constexpr auto reserve_hint()
+        requires approximately_sized_range<AnyViewT>
+    {
+        return beman::any_view::reserve_hint(base);
+    }
+};
+
+} // namespace detail
 } // namespace beman::any_view
 
+template <class AnyViewT>
+inline constexpr bool std::ranges::enable_borrowed_range<beman::any_view::detail::converted_view<AnyViewT>> =
+    std::ranges::enable_borrowed_range<AnyViewT>;
+
 template <class ElementT, beman::any_view::any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
 inline constexpr bool
     std::ranges::enable_borrowed_range<beman::any_view::any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>> =
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_BATCH_HPP
+#define BEMAN_ANY_VIEW_BATCH_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace beman::any_view {
+
+// input view of an any_view in batches of up to SizeV elements, each of which is fetched with a single dispatch
+// elements of a batch remain valid until the next batch is fetched
+template <std::size_t SizeV, class AnyViewT>
+class batch_view : public std::ranges::view_interface<batch_view<SizeV, AnyViewT>> {
+    static_assert(SizeV != 0, "batch size must be positive");
+
+    using reference        = std::ranges::range_reference_t<AnyViewT>;
+    using element          = detail::batch_element<reference>;
+    using element_type     = typename element::type;
+    using polymorphic_type = decltype(detail::any_view_access::begin_polymorphic(std::declval<AnyViewT&>()));
+
+    template <detail::protocol ProtocolT>
+    static constexpr auto dispatch = detail::dispatch<ProtocolT, polymorphic_type>;
+
+    struct load_fn {
+        [[nodiscard]] constexpr typename element::reference operator()(element_type& element) const noexcept {
+            return batch_view::element::load(element);
+        }
+    };
+
+    AnyViewT                        base;
+    std::optional<polymorphic_type> poly;
+    std::array<element_type, SizeV> buffer{};
+    std::size_t                     size = 0;
+
+    constexpr void fetch(bool advance) {
+        size = dispatch<detail::next_batch_t<reference>>(*poly, buffer.data(), SizeV, advance);
+    }
+
+  public:
+    using batch = std::ranges::transform_view<std::span<element_type>, load_fn>;
+
+    class iterator {
+        batch_view* parent;
+
+      public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type       = batch;
+        using difference_type  = std::ptrdiff_t;
+
+        constexpr explicit iterator(batch_view* parent) noexcept : parent(parent) {}
+
+        constexpr iterator(iterator&&) noexcept = default;
+
+        constexpr iterator& operator=(iterator&&) noexcept = default;
+
+        [[nodiscard]] constexpr batch operator*() const {
+            return batch{std::span{parent->buffer.data(), parent->size}, load_fn{}};
+        }
+
+        constexpr iterator& operator++() {
+            parent->fetch(true);
+            return *this;
+        }
+
+        constexpr void operator++(int) { ++*this; }
+
+        [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept { return parent->size == 0; }
+    };
+
+    constexpr explicit batch_view(AnyViewT base) noexcept : base(std::move(base)) {}
+
+    [[nodiscard]] constexpr iterator begin() {
+        poly.emplace(detail::any_view_access::begin_polymorphic(base));
+        fetch(false);
+        return iterator{this};
+    }
+
+    [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
+template <std::size_t SizeV, class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+[[nodiscard]] constexpr batch_view<SizeV, any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>>
+batches(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT> view) noexcept {
+    return batch_view<SizeV, any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>>{std::move(view)};
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_BATCH_HPP
@@ -7,8 +7,10 @@
 #include <beman/any_view/detail/no_unique_address.hpp>
 
 #include <concepts>
+#include <cstddef>
 #include <iterator>
 #include <ranges>
+#include <type_traits>
 
 namespace beman::any_view::detail {
 
@@ -26,8 +28,37 @@ struct iterator_adaptor : adaptor_base {
     BEMAN_ANY_VIEW_NO_UNIQUE_ADDRESS SentinelT sentinel;
 };
 
+template <class IteratorT>
+using erased_pointer_t = std::add_pointer_t<std::iter_reference_t<IteratorT>>;
+
+template <class IteratorT, class SentinelT>
+concept pointer_erasable =
+    std::contiguous_iterator<IteratorT> and std::sized_sentinel_for<SentinelT, IteratorT> and
+    std::same_as<std::iter_difference_t<IteratorT>, std::ptrdiff_t> and
+    std::same_as<std::iter_rvalue_reference_t<IteratorT>, std::iter_rvalue_reference_t<erased_pointer_t<IteratorT>>>;
+
+// contiguous iterators with a sized sentinel are erased as a pair of pointers, so that views of the same elements such
+// as std::ranges::ref_view<std::vector<T>>, std::ranges::owning_view<std::vector<T>> and std::span<T> share the
+// witnesses of their iterators and every function they point to
+template <class IteratorT, class SentinelT>
+using erased_iterator_adaptor_t =
+    std::conditional_t<pointer_erasable<IteratorT, SentinelT>,
+                       iterator_adaptor<erased_pointer_t<IteratorT>, erased_pointer_t<IteratorT>>,
+                       iterator_adaptor<IteratorT, SentinelT>>;
+
+template <std::ranges::view ViewT>
+using iterator_adaptor_for = erased_iterator_adaptor_t<std::ranges::iterator_t<ViewT>, std::ranges::sentinel_t<ViewT>>;
+
 template <std::ranges::view ViewT>
-using iterator_adaptor_for = iterator_adaptor<std::ranges::iterator_t<ViewT>, std::ranges::sentinel_t<ViewT>>;
+[[nodiscard]] constexpr iterator_adaptor_for<ViewT> make_iterator_adaptor_for(ViewT& view) {
+    if constexpr (pointer_erasable<std::ranges::iterator_t<ViewT>, std::ranges::sentinel_t<ViewT>>) {
+        const auto first   = std::ranges::begin(view);
+        const auto address = std::to_address(first);
+        return {.iterator = address, .sentinel = address + (std::ranges::end(view) - first)};
+    } else {
+        return {.iterator = std::ranges::begin(view), .sentinel = std::ranges::end(view)};
+    }
+}
 
 template <std::ranges::view ViewT, any_view_options OptsV>
 struct view_adaptor : adaptor_base {
@@ -38,6 +69,15 @@ struct view_adaptor : adaptor_base {
     BEMAN_ANY_VIEW_NO_UNIQUE_ADDRESS ViewT view;
 };
 
+// allocates the storage of AdaptorT with allocator whenever it does not fit inplace
+template <adaptor AdaptorT, class AllocatorT>
+struct allocated_adaptor : AdaptorT {
+    BEMAN_ANY_VIEW_NO_UNIQUE_ADDRESS AllocatorT allocator;
+};
+
+template <class T>
+concept allocator_aware_adaptor = adaptor<T> and requires(const T& adaptor) { adaptor.allocator; };
+
 } // namespace beman::any_view::detail
 
 #endif // BEMAN_ANY_VIEW_DETAIL_ADAPTORS_HPP
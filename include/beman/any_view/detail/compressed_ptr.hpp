@@ -54,6 +54,25 @@ class compressed_ptr<T> {
 #endif // _MSC_VER
 };
 
+// holds a copy of its pointee, trading size for one less dependent load
+template <class T>
+class inline_ptr {
+    std::remove_const_t<T> value;
+
+  public:
+    constexpr explicit inline_ptr(T* value) noexcept : value(*value) {}
+
+    [[nodiscard]] constexpr operator T*() const noexcept { return &value; }
+
+#if _MSC_VER
+    template <class MemberT, class BaseT>
+        requires std::derived_from<T, BaseT>
+    [[nodiscard]] constexpr const MemberT& operator->*(MemberT BaseT::* member_ptr) const noexcept {
+        return value.*member_ptr;
+    }
+#endif // _MSC_VER
+};
+
 } // namespace beman::any_view::detail
 
 #endif // BEMAN_ANY_VIEW_DETAIL_COMPRESSED_PTR_HPP
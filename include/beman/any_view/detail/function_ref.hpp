@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_DETAIL_FUNCTION_REF_HPP
+#define BEMAN_ANY_VIEW_DETAIL_FUNCTION_REF_HPP
+
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace beman::any_view::detail {
+
+struct callable_base {};
+
+template <class T>
+concept callable = std::derived_from<T, callable_base>;
+
+template <class SignatureT>
+class function_ref;
+
+// non-owning reference to a callable derived from callable_base
+template <class RetT, class... ArgsT>
+class function_ref<RetT(ArgsT...)> {
+    // static_cast from void pointer is not constexpr until C++26
+    callable_base* callable_ptr;
+    RetT (*invoke_ptr)(callable_base&, ArgsT...);
+
+  public:
+    template <callable CallableT>
+        requires std::is_invocable_r_v<RetT, CallableT&, ArgsT...>
+    constexpr function_ref(CallableT& callable) noexcept
+        : callable_ptr(std::addressof(callable)), invoke_ptr([](callable_base& base, ArgsT... args) -> RetT {
+              return std::invoke(static_cast<CallableT&>(base), std::forward<ArgsT>(args)...);
+          }) {}
+
+    constexpr RetT operator()(ArgsT... args) const { return invoke_ptr(*callable_ptr, std::forward<ArgsT>(args)...); }
+};
+
+} // namespace beman::any_view::detail
+
+#endif // BEMAN_ANY_VIEW_DETAIL_FUNCTION_REF_HPP
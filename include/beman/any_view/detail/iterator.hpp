@@ -66,11 +66,21 @@ class iterator : public iterator_category_type<iterator_concept_t<OptsV>, std::i
 
     static constexpr bool has_index = std::is_same_v<cache_or_index_type, DiffT>;
 
+    // store the size of a sized iterator with an index, or the end address of a contiguous iterator if its sentinel
+    // is a sized sentinel, to avoid runtime dispatch for comparing with the sentinel
+    static constexpr bool has_size = has_index and flag_is_set<OptsV, any_view_options::sized>;
+
+    // distinct from no_cache so that both members share an address if neither is stored
+    struct no_bound {};
+
+    using bound_type = std::conditional_t<contiguous, cache_type, std::conditional_t<has_size, DiffT, no_bound>>;
+
     template <protocol ProtocolT>
     static constexpr auto dispatch = detail::dispatch<ProtocolT, polymorphic_type>;
 
     polymorphic_type poly{std::in_place_type<iterator_adaptor_for<default_view<ElementT, RefT, RValueRefT, DiffT>>>};
     BEMAN_ANY_VIEW_NO_UNIQUE_ADDRESS cache_or_index_type cache_or_index{make_cache_or_index()};
+    BEMAN_ANY_VIEW_NO_UNIQUE_ADDRESS bound_type bound{make_bound()};
 
     constexpr cache_or_index_type make_cache_or_index() const {
         if constexpr (has_cache) {
@@ -80,15 +90,48 @@ class iterator : public iterator_category_type<iterator_concept_t<OptsV>, std::i
         }
     }
 
+    constexpr bound_type make_bound() const {
+        if constexpr (contiguous) {
+            return dispatch<end_address_t<RefT>>(poly);
+        } else {
+            return {};
+        }
+    }
+
+    // the polymorphic iterator is only kept in sync while the end address is unknown
+    [[nodiscard]] constexpr bool has_end_address() const noexcept {
+        if constexpr (contiguous) {
+            return bound != nullptr;
+        } else {
+            return false;
+        }
+    }
+
+    constexpr void sync() {
+        if constexpr (contiguous) {
+            if (not has_end_address()) {
+                dispatch<sync_t<RefT>>(poly, cache_or_index);
+            }
+        }
+    }
+
   public:
     using iterator_concept = iterator_concept_t<OptsV>;
     using value_type       = std::remove_cv_t<ElementT>;
     using difference_type  = DiffT;
 
     template <class GetPolyT>
-        requires std::is_invocable_r_v<polymorphic_type, GetPolyT>
+        requires std::is_invocable_r_v<polymorphic_type, GetPolyT> and (not has_size)
     constexpr explicit iterator(GetPolyT get_poly) : poly(get_poly()) {}
 
+    template <class GetPolyT, class GetSizeT>
+        requires std::is_invocable_r_v<polymorphic_type, GetPolyT> and std::is_invocable_v<GetSizeT>
+    constexpr iterator(GetPolyT get_poly, GetSizeT get_size) : poly(get_poly()) {
+        if constexpr (has_size) {
+            bound = static_cast<DiffT>(get_size());
+        }
+    }
+
     constexpr iterator() noexcept
         requires forward
     = default;
@@ -135,9 +178,7 @@ class iterator : public iterator_category_type<iterator_concept_t<OptsV>, std::i
     constexpr iterator& operator++() {
         if constexpr (contiguous or has_index) {
             ++cache_or_index;
-            if constexpr (contiguous) {
-                dispatch<sync_t<RefT>>(poly, cache_or_index);
-            }
+            sync();
         } else if constexpr (has_cache) {
             cache_or_index = dispatch<next_t<RefT>>(poly);
         } else {
@@ -171,9 +212,7 @@ class iterator : public iterator_category_type<iterator_concept_t<OptsV>, std::i
     {
         if constexpr (contiguous or has_index) {
             --cache_or_index;
-            if constexpr (contiguous) {
-                dispatch<sync_t<RefT>>(poly, cache_or_index);
-            }
+            sync();
         } else if constexpr (has_cache) {
             cache_or_index = dispatch<prev_t<RefT>>(poly);
         } else {
@@ -215,9 +254,7 @@ class iterator : public iterator_category_type<iterator_concept_t<OptsV>, std::i
     {
         if constexpr (contiguous or has_index) {
             cache_or_index += offset;
-            if constexpr (contiguous) {
-                dispatch<sync_t<RefT>>(poly, cache_or_index);
-            }
+            sync();
         } else {
             static_assert(has_cache, "random access iterator with no index has cache");
             cache_or_index = dispatch<advance_t<RefT, DiffT>>(poly, offset);
@@ -262,9 +299,15 @@ class iterator : public iterator_category_type<iterator_concept_t<OptsV>, std::i
     }
 
     [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const {
-        // sentinel comparison must dispatch for a contiguous iterator
+        // sentinel comparison must dispatch for a contiguous iterator with no end address
         if constexpr (has_cache and not contiguous) {
             return cache_or_index == cache_type{};
+        } else if constexpr (contiguous) {
+            return has_end_address() ? cache_or_index == bound : dispatch<sentinel_compare_t>(poly);
+        } else if constexpr (has_size) {
+            return cache_or_index == bound;
+        } else if constexpr (has_index) {
+            return dispatch<sentinel_compare_at_t<DiffT>>(poly, cache_or_index);
         } else {
             return dispatch<sentinel_compare_t>(poly);
         }
@@ -10,19 +10,58 @@
 
 namespace beman::any_view::detail {
 
+// polymorphic objects of a single inline protocol hold a copy of their witness instead of a pointer to it
+template <protocol ProtocolT>
+struct inline_protocol : inherit<ProtocolT> {};
+
+template <protocol ProtocolT, storage StorageT>
+struct witness_ptr {
+    using type = const witness<ProtocolT, StorageT>*;
+};
+
+template <protocol ProtocolT, storage StorageT>
+struct witness_ptr<inline_protocol<ProtocolT>, StorageT> : witness_ptr<ProtocolT, StorageT> {};
+
+template <protocol ProtocolT, storage StorageT>
+using witness_ptr_t = typename witness_ptr<ProtocolT, StorageT>::type;
+
+template <storage StorageT, protocol... ProtocolTs>
+struct witness_ptrs {
+    using type = compressed_ptr<const witness<ProtocolTs, StorageT>...>;
+};
+
+template <storage StorageT, protocol ProtocolT>
+struct witness_ptrs<StorageT, inline_protocol<ProtocolT>> {
+    using type = inline_ptr<const witness<ProtocolT, StorageT>>;
+};
+
 template <storage StorageT, protocol... ProtocolTs>
 class basic_polymorphic {
-    using witness_ptrs_type = compressed_ptr<const witness<ProtocolTs, StorageT>...>;
+    using witness_ptrs_type = typename witness_ptrs<StorageT, ProtocolTs...>::type;
+
+    template <storage, protocol...>
+    friend class basic_polymorphic;
 
     StorageT          storage;
     witness_ptrs_type witness_ptrs;
 
+    // trivially copyable adaptors are copied and moved bitwise, without dispatch
+    template <class PolyT>
+    [[nodiscard]] static constexpr StorageT copy_storage(const PolyT& other) {
+        return other.trivially_copyable() ? other.storage : other.entry(copy_t<StorageT>{})(other.storage);
+    }
+
+    template <class PolyT>
+    [[nodiscard]] static constexpr StorageT move_storage(PolyT& other) noexcept {
+        return other.trivially_copyable() ? other.storage : other.entry(move_t<StorageT>{})(std::move(other.storage));
+    }
+
   public:
     constexpr basic_polymorphic(const basic_polymorphic& other)
-        : storage(other.entry(copy_t<StorageT>{})(other.storage)), witness_ptrs(other.witness_ptrs) {}
+        : storage(copy_storage(other)), witness_ptrs(other.witness_ptrs) {}
 
     constexpr basic_polymorphic(basic_polymorphic&& other) noexcept
-        : storage(other.entry(move_t<StorageT>{})(std::move(other.storage))), witness_ptrs(other.witness_ptrs) {}
+        : storage(move_storage(other)), witness_ptrs(other.witness_ptrs) {}
 
     template <adaptor AdaptorT>
     constexpr basic_polymorphic(AdaptorT&& adaptor)
@@ -35,20 +74,24 @@ class basic_polymorphic {
 
     template <class GetStorageT>
         requires std::is_invocable_r_v<StorageT, GetStorageT>
-    constexpr basic_polymorphic(GetStorageT get_storage, const witness<ProtocolTs, StorageT>*... witness_ptrs)
+    constexpr basic_polymorphic(GetStorageT get_storage, witness_ptr_t<ProtocolTs, StorageT>... witness_ptrs)
         : storage(get_storage()), witness_ptrs(witness_ptrs...) {}
 
     // converting constructors
 
     template <std::derived_from<ProtocolTs>... OtherProtocolTs>
     constexpr basic_polymorphic(const basic_polymorphic<StorageT, OtherProtocolTs...>& other)
-        : storage(other.entry(copy_t<StorageT>{})(other.get())), witness_ptrs(other.witnesses()) {}
+        : storage(copy_storage(other)), witness_ptrs(other.witnesses()) {}
 
     template <std::derived_from<ProtocolTs>... OtherProtocolTs>
     constexpr basic_polymorphic(basic_polymorphic<StorageT, OtherProtocolTs...>&& other) noexcept
-        : storage(other.entry(move_t<StorageT>{})(std::move(other.get()))), witness_ptrs(other.witnesses()) {}
+        : storage(move_storage(other)), witness_ptrs(other.witnesses()) {}
 
-    constexpr ~basic_polymorphic() { entry(destroy_t<StorageT>{})(storage); }
+    constexpr ~basic_polymorphic() {
+        if (not trivially_copyable()) {
+            entry(destroy_t<StorageT>{})(storage);
+        }
+    }
 
     constexpr basic_polymorphic& operator=(const basic_polymorphic& other) {
         if (this == std::addressof(other)) {
@@ -100,6 +143,11 @@ class basic_polymorphic {
 
     constexpr witness_ptrs_type witnesses() const noexcept { return witness_ptrs; }
 
+    [[nodiscard]] constexpr bool trivially_copyable() const noexcept {
+        return not std::is_constant_evaluated() and
+               witness_ptrs->*&witness<destroy_t<StorageT>, StorageT>::trivially_copyable;
+    }
+
     template <protocol ProtocolT>
         requires(... or std::derived_from<ProtocolTs, ProtocolT>)
     constexpr const signature<ProtocolT, StorageT>* entry(ProtocolT) const noexcept {
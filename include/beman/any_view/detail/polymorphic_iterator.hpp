@@ -4,11 +4,14 @@
 #define BEMAN_ANY_VIEW_DETAIL_POLYMORPHIC_ITERATOR_HPP
 
 #include <beman/any_view/detail/concepts.hpp>
+#include <beman/any_view/detail/function_ref.hpp>
 #include <beman/any_view/detail/polymorphic.hpp>
 #include <beman/any_view/detail/small_storage.hpp>
 #include <beman/any_view/detail/unreachable.hpp>
 
+#include <cstddef>
 #include <optional>
+#include <span>
 
 namespace beman::any_view::detail {
 
@@ -38,6 +41,31 @@ struct iter_cache<RefT> {
 template <class RefT>
 using iter_cache_t = typename iter_cache<RefT>::type;
 
+template <class RefT>
+struct batch_element {
+    using type      = std::optional<RefT>;
+    using reference = RefT&;
+
+    // emplace rather than assign so a proxy reference does not assign through to the previous element
+    static constexpr void store(type& element, RefT ref) { element.emplace(std::move(ref)); }
+
+    [[nodiscard]] static constexpr reference load(type& element) noexcept { return *element; }
+};
+
+template <class RefT>
+    requires std::is_reference_v<RefT>
+struct batch_element<RefT> {
+    using type      = std::add_pointer_t<RefT>;
+    using reference = RefT;
+
+    static constexpr void store(type& element, RefT ref) noexcept { element = std::addressof(ref); }
+
+    [[nodiscard]] static constexpr reference load(type element) noexcept { return static_cast<RefT>(*element); }
+};
+
+template <class RefT>
+using batch_element_t = typename batch_element<RefT>::type;
+
 struct sentinel_compare_t : unary_protocol {
     template <not_adaptor T>
     static bool fn(const T& self);
@@ -96,6 +124,118 @@ struct next_t : unary_protocol {
     }
 };
 
+// fills buffer with up to count elements and leaves the iterator on the last one, so that it stays valid
+// returns zero only if there are no more elements
+template <class RefT>
+struct next_batch_t : unary_protocol {
+    template <not_adaptor T>
+    static std::size_t fn(T& self, batch_element_t<RefT>* buffer, std::size_t count, bool advance);
+
+    template <adaptor IteratorAdaptorT>
+    [[nodiscard]] static constexpr std::size_t
+    fn(IteratorAdaptorT& adaptor, batch_element_t<RefT>* buffer, std::size_t count, bool advance) {
+        // references from an input iterator may dangle once it is incremented
+        if constexpr (std::is_reference_v<RefT> and not std::forward_iterator<decltype(adaptor.iterator)>) {
+            count = count < 1 ? count : 1;
+        }
+
+        if (advance and adaptor.iterator != adaptor.sentinel) {
+            ++adaptor.iterator;
+        }
+
+        std::size_t size = 0;
+
+        while (size != count and adaptor.iterator != adaptor.sentinel) {
+            batch_element<RefT>::store(buffer[size], *adaptor.iterator);
+
+            if (++size != count) {
+                ++adaptor.iterator;
+            }
+        }
+
+        return size;
+    }
+};
+
+// moves up to count elements into sink and leaves the iterator past the last one, since nothing refers to it any more
+// returns fewer than count only if there are no more elements
+template <class RValueRefT>
+struct move_batch_t : unary_protocol {
+    template <not_adaptor T>
+    static std::size_t fn(T& self, function_ref<void(RValueRefT)> sink, std::size_t count);
+
+    template <adaptor IteratorAdaptorT>
+    [[nodiscard]] static constexpr std::size_t
+    fn(IteratorAdaptorT& adaptor, function_ref<void(RValueRefT)> sink, std::size_t count) {
+        std::size_t size = 0;
+
+        for (; size != count and adaptor.iterator != adaptor.sentinel; ++size, ++adaptor.iterator) {
+            sink(std::ranges::iter_move(adaptor.iterator));
+        }
+
+        return size;
+    }
+};
+
+template <class IteratorT, class RefT>
+concept addresses_any_element = std::is_lvalue_reference_v<std::iter_reference_t<IteratorT>> and
+                                not uses_nonqualification_pointer_conversion<
+                                    std::add_pointer_t<std::iter_reference_t<IteratorT>>, std::add_pointer_t<RefT>>;
+
+// returns the longest run of adjacent elements from the iterator and leaves the iterator on its last element
+// runs are a single element if adjacency cannot be observed, and empty only if there are no more elements
+template <class RefT>
+struct next_segment_t : unary_protocol {
+    using segment_type = std::span<std::remove_reference_t<RefT>>;
+
+    template <not_adaptor T>
+    static segment_type fn(T& self, bool advance);
+
+    template <adaptor IteratorAdaptorT>
+    [[nodiscard]] static constexpr segment_type fn(IteratorAdaptorT& adaptor, bool advance) {
+        using iterator_type = decltype(adaptor.iterator);
+
+        auto& iterator = adaptor.iterator;
+        auto& sentinel = adaptor.sentinel;
+
+        if (advance and iterator != sentinel) {
+            ++iterator;
+        }
+
+        if (iterator == sentinel) {
+            return {};
+        }
+
+        if constexpr (addresses_any_element<iterator_type, RefT> and std::contiguous_iterator<iterator_type> and
+                      std::sized_sentinel_for<decltype(adaptor.sentinel), iterator_type>) {
+            const auto first = std::to_address(iterator);
+            const auto size  = sentinel - iterator;
+            iterator += size - 1;
+            return segment_type{first, static_cast<std::size_t>(size)};
+        } else if constexpr (addresses_any_element<iterator_type, RefT> and std::forward_iterator<iterator_type>) {
+            const auto  first = std::addressof(*iterator);
+            std::size_t size  = 1;
+
+            // first + size is at most one past the last adjacent element, so it is always a valid pointer
+            for (auto next = std::ranges::next(iterator); next != sentinel and std::addressof(*next) == first + size;
+                 ++next, ++size) {
+                iterator = next;
+            }
+
+            return segment_type{first, size};
+        } else {
+            return segment_type{std::addressof(static_cast<RefT>(*iterator)), 1};
+        }
+    }
+};
+
+template <class RefT>
+struct segment_protocol : inherit<> {};
+
+template <class RefT>
+    requires std::is_lvalue_reference_v<RefT>
+struct segment_protocol<RefT> : inherit<next_segment_t<RefT>> {};
+
 struct decrement_t : unary_protocol {
     template <not_adaptor T>
     static void fn(T& self);
@@ -118,6 +258,18 @@ struct prev_t : unary_protocol {
     }
 };
 
+// compares the iterator advanced by n with the sentinel, since an iterator with an index is never advanced itself
+template <class DiffT>
+struct sentinel_compare_at_t : unary_protocol {
+    template <not_adaptor T>
+    static bool fn(const T& self, DiffT n);
+
+    template <adaptor IteratorAdaptorT>
+    [[nodiscard]] static constexpr bool fn(const IteratorAdaptorT& adaptor, DiffT n) {
+        return adaptor.iterator + n == adaptor.sentinel;
+    }
+};
+
 template <class RefT, class DiffT>
 struct dereference_at_t : unary_protocol {
     template <not_adaptor T>
@@ -175,6 +327,25 @@ struct sync_t : unary_protocol {
     }
 };
 
+// returns the address of the sentinel if it is a sized sentinel and the iterator is not equal to it
+// returns a null pointer otherwise, so that an empty range is compared through sentinel_compare_t
+template <class RefT>
+struct end_address_t : unary_protocol {
+    template <not_adaptor T>
+    static iter_cache_t<RefT> fn(const T& self);
+
+    template <adaptor IteratorAdaptorT>
+    [[nodiscard]] static constexpr iter_cache_t<RefT> fn(const IteratorAdaptorT& adaptor) {
+        if constexpr (std::sized_sentinel_for<decltype(adaptor.sentinel), decltype(adaptor.iterator)>) {
+            if (adaptor.iterator != adaptor.sentinel) {
+                return std::to_address(adaptor.iterator) + (adaptor.sentinel - adaptor.iterator);
+            }
+        }
+
+        return {};
+    }
+};
+
 struct equality_compare_t : symmetric_binary_protocol {
     [[nodiscard]] static constexpr bool default_value() noexcept { return false; }
 
@@ -250,15 +421,22 @@ template <has_cache RefT, class RValueRefT>
     requires convertible_to_borrowed<rvalue_ref_t<RefT>, RValueRefT>
 struct input_cache_protocol<RefT, RValueRefT> : inherit<cache_t<RefT>, next_t<RefT>> {};
 
+// each protocol lists the entries dispatched for every element first, then the protocol it refines, then the
+// entries for lifetime, batches and conversions, so that the per-element entries of an iterator share the first cache
+// line of its witness
+// the protocol it refines need not be a first base for its witness to convert to the witness of that protocol
 template <class RefT, class RValueRefT>
-struct input_protocol : inherit<move_t<iterator_storage>,
+struct input_protocol : inherit<input_cache_protocol<RefT, RValueRefT>,
+                                sentinel_compare_t,
+                                move_t<iterator_storage>,
                                 destroy_t<iterator_storage>,
-                                input_cache_protocol<RefT, RValueRefT>,
-                                sentinel_compare_t> {};
+                                next_batch_t<RefT>,
+                                move_batch_t<RValueRefT>,
+                                segment_protocol<RefT>> {};
 
 template <class RefT, class RValueRefT>
 struct forward_protocol
-    : inherit<input_protocol<RefT, RValueRefT>, copy_t<iterator_storage>, type_t, equality_compare_t> {};
+    : inherit<equality_compare_t, input_protocol<RefT, RValueRefT>, copy_t<iterator_storage>, type_t> {};
 
 template <class RefT>
 struct bidirectional_cache_protocol : inherit<decrement_t> {};
@@ -267,22 +445,24 @@ template <has_cache RefT>
 struct bidirectional_cache_protocol<RefT> : inherit<prev_t<RefT>> {};
 
 template <class RefT, class RValueRefT>
-struct bidirectional_protocol : inherit<forward_protocol<RefT, RValueRefT>, bidirectional_cache_protocol<RefT>> {};
+struct bidirectional_protocol : inherit<bidirectional_cache_protocol<RefT>, forward_protocol<RefT, RValueRefT>> {};
 
 template <class RefT, class RValueRefT, class DiffT>
-struct random_access_cache_protocol : inherit<dereference_at_t<RefT, DiffT>, iter_move_at_t<RValueRefT, DiffT>> {};
+struct random_access_cache_protocol
+    : inherit<dereference_at_t<RefT, DiffT>, iter_move_at_t<RValueRefT, DiffT>, sentinel_compare_at_t<DiffT>> {};
 
 template <has_cache RefT, class RValueRefT, class DiffT>
 struct random_access_cache_protocol<RefT, RValueRefT, DiffT> : inherit<advance_t<RefT, DiffT>> {};
 
 template <class RefT, class RValueRefT, class DiffT>
-struct random_access_protocol : inherit<bidirectional_protocol<RefT, RValueRefT>,
-                                        random_access_cache_protocol<RefT, RValueRefT, DiffT>,
+struct random_access_protocol : inherit<random_access_cache_protocol<RefT, RValueRefT, DiffT>,
+                                        bidirectional_protocol<RefT, RValueRefT>,
                                         three_way_compare_t,
                                         subtract_t<DiffT>> {};
 
 template <class RefT, class RValueRefT, class DiffT>
-struct contiguous_protocol : inherit<random_access_protocol<RefT, RValueRefT, DiffT>, sync_t<RefT>> {};
+struct contiguous_protocol
+    : inherit<random_access_protocol<RefT, RValueRefT, DiffT>, sync_t<RefT>, end_address_t<RefT>> {};
 
 template <class RefT, class RValueRefT, class DiffT, any_view_options OptsV>
 [[nodiscard]] consteval auto get_iterator_protocol() {
@@ -305,7 +485,11 @@ template <class RefT, class RValueRefT, class DiffT, any_view_options OptsV>
 using iterator_protocol = decltype(get_iterator_protocol<RefT, RValueRefT, DiffT, OptsV>());
 
 template <class RefT, class RValueRefT, class DiffT, any_view_options OptsV>
-using polymorphic_iterator = basic_polymorphic<iterator_storage, iterator_protocol<RefT, RValueRefT, DiffT, OptsV>>;
+using polymorphic_iterator =
+    basic_polymorphic<iterator_storage,
+                      std::conditional_t<flag_is_set<OptsV, any_view_options::inline_dispatch>,
+                                         inline_protocol<iterator_protocol<RefT, RValueRefT, DiffT, OptsV>>,
+                                         iterator_protocol<RefT, RValueRefT, DiffT, OptsV>>>;
 
 } // namespace beman::any_view::detail
 
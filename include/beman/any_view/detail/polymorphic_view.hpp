@@ -3,11 +3,34 @@
 #ifndef BEMAN_ANY_VIEW_DETAIL_POLYMORPHIC_VIEW_HPP
 #define BEMAN_ANY_VIEW_DETAIL_POLYMORPHIC_VIEW_HPP
 
+#include <beman/any_view/detail/function_ref.hpp>
 #include <beman/any_view/detail/polymorphic_iterator.hpp>
+#include <beman/any_view/detail/pushdown_view.hpp>
+#include <beman/any_view/detail/unreachable.hpp>
 #include <beman/any_view/reserve_hint.hpp>
 
+#include <span>
+
 namespace beman::any_view::detail {
 
+// iterators only carry the allocator of their view if they do not fit inplace
+template <adaptor ViewAdaptorT>
+[[nodiscard]] constexpr auto make_iterator_adaptor(ViewAdaptorT& adaptor) {
+    using adaptor_type = typename ViewAdaptorT::adaptor_type;
+
+    if constexpr (allocator_aware_adaptor<ViewAdaptorT> and not iterator_storage::fits_inplace<adaptor_type>) {
+        return allocated_adaptor<adaptor_type, decltype(adaptor.allocator)>{
+            make_iterator_adaptor_for(adaptor.view),
+            adaptor.allocator,
+        };
+    } else {
+        return make_iterator_adaptor_for(adaptor.view);
+    }
+}
+
+template <adaptor ViewAdaptorT>
+using iterator_adaptor_t = decltype(make_iterator_adaptor(std::declval<ViewAdaptorT&>()));
+
 template <class RefT, class RValueRefT, class DiffT>
 struct iterator_witness_t : nullary_protocol {
     template <any_view_options OptsV>
@@ -21,7 +44,7 @@ struct iterator_witness_t : nullary_protocol {
     template <adaptor ViewAdaptorT>
     [[nodiscard]] static constexpr const witness_type* fn() noexcept {
         using protocol_type = protocol_for<ViewAdaptorT::options>;
-        using adaptor_type  = typename ViewAdaptorT::adaptor_type;
+        using adaptor_type  = iterator_adaptor_t<ViewAdaptorT>;
         return std::addressof(witness_for<protocol_type, iterator_storage, adaptor_type>);
     }
 };
@@ -32,11 +55,103 @@ struct begin_t : unary_protocol {
 
     template <adaptor ViewAdaptorT>
     [[nodiscard]] static constexpr iterator_storage fn(ViewAdaptorT& adaptor) {
-        using adaptor_type = typename ViewAdaptorT::adaptor_type;
-        return iterator_storage{adaptor_type{
-            .iterator = std::ranges::begin(adaptor.view),
-            .sentinel = std::ranges::end(adaptor.view),
-        }};
+        return iterator_storage{make_iterator_adaptor(adaptor)};
+    }
+};
+
+// invokes sink with each element until it returns false
+// returns whether every element was visited
+template <class RefT>
+struct for_each_t : unary_protocol {
+    template <not_adaptor T>
+    static bool fn(T& self, function_ref<bool(RefT)> sink);
+
+    template <adaptor ViewAdaptorT>
+    [[nodiscard]] static constexpr bool fn(ViewAdaptorT& adaptor, function_ref<bool(RefT)> sink) {
+        auto       iterator = std::ranges::begin(adaptor.view);
+        const auto sentinel = std::ranges::end(adaptor.view);
+
+        for (; iterator != sentinel; ++iterator) {
+            if (not sink(*iterator)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+// appends each element of the view through sinks with a single dispatch, reserving first if it is approximately sized
+// elements of a contiguous view are appended as a single span if they are exactly of the value type, and moving them
+// out copies them, so they must also be trivially copyable if MoveV
+template <class RefT, bool MoveV>
+struct append_to_t : unary_protocol {
+    using segment_type = std::span<const std::remove_cvref_t<RefT>>;
+
+    template <class ViewT>
+    static constexpr bool appends_segment =
+        std::ranges::contiguous_range<ViewT> and
+        std::sized_sentinel_for<std::ranges::sentinel_t<ViewT>, std::ranges::iterator_t<ViewT>> and
+        std::same_as<std::ranges::range_value_t<ViewT>, std::remove_cvref_t<RefT>> and
+        (not MoveV or std::is_trivially_copyable_v<std::remove_cvref_t<RefT>>);
+
+    template <not_adaptor T>
+    static void fn(T&                               self,
+                   function_ref<void(std::size_t)>  reserve,
+                   function_ref<void(segment_type)> append_segment,
+                   function_ref<void(RefT)>         append);
+
+    template <adaptor ViewAdaptorT>
+    static constexpr void fn(ViewAdaptorT&                    adaptor,
+                             function_ref<void(std::size_t)>  reserve,
+                             function_ref<void(segment_type)> append_segment,
+                             function_ref<void(RefT)>         append) {
+        using view_type = decltype(adaptor.view);
+
+        if constexpr (approximately_sized_range<view_type>) {
+            reserve(static_cast<std::size_t>(beman::any_view::reserve_hint(adaptor.view)));
+        }
+
+        auto       iterator = std::ranges::begin(adaptor.view);
+        const auto sentinel = std::ranges::end(adaptor.view);
+
+        if constexpr (appends_segment<view_type>) {
+            if (iterator != sentinel) {
+                append_segment(segment_type{std::to_address(iterator), static_cast<std::size_t>(sentinel - iterator)});
+            }
+        } else {
+            for (; iterator != sentinel; ++iterator) {
+                if constexpr (MoveV) {
+                    append(std::ranges::iter_move(iterator));
+                } else {
+                    append(*iterator);
+                }
+            }
+        }
+    }
+};
+
+template <class RefT>
+using copy_to_t = append_to_t<RefT, false>;
+
+template <class RValueRefT>
+using move_to_t = append_to_t<RValueRefT, true>;
+
+// returns a pointer to the view if its type is type, or a null pointer otherwise
+struct target_t : unary_protocol {
+    template <not_adaptor T>
+    static const void* fn(const T& self, const std::type_info& type) noexcept;
+
+    template <adaptor ViewAdaptorT>
+    [[nodiscard]] static constexpr const void* fn(const ViewAdaptorT& adaptor, const std::type_info& type) noexcept {
+        const auto& view_type = typeid(adaptor.view);
+
+        // std::type_info::operator== is not constexpr until C++23
+        if (std::is_constant_evaluated() ? &view_type != &type : view_type != type) {
+            return nullptr;
+        }
+
+        return std::addressof(adaptor.view);
     }
 };
 
@@ -56,6 +171,150 @@ struct reserve_hint_t : unary_protocol {
 // inplace storage sufficient for a std::vector<T>
 using view_storage = small_storage<3 * sizeof(void*)>;
 
+template <class RefT, class RValueRefT, class DiffT, class... ConstRefTs>
+struct uncopyable_protocol;
+
+template <class RefT, class RValueRefT, class DiffT, class... ConstRefTs>
+struct copyable_protocol;
+
+template <class DiffT>
+struct sized_protocol;
+
+struct unsized_protocol : inherit<> {};
+
+template <class DiffT, any_view_options OptsV>
+consteval auto get_sized_protocol();
+
+template <class T>
+concept sliceable_adaptor =
+    adaptor<T> and flag_is_set<T::options, any_view_options::random_access | any_view_options::sized>;
+
+template <class T>
+concept reversible_adaptor = adaptor<T> and flag_is_set<T::options, any_view_options::bidirectional> and
+                             not flag_is_set<T::options, any_view_options::contiguous>;
+
+// the adaptors that pushdowns make of the view of an adaptor apply to its view directly, and slicing, windowing or
+// reversing them again makes one of a closed set of views, so that pushdowns never nest type erasure
+struct slice_pushdown {
+    template <class ViewAdaptorT>
+    static constexpr bool enabled = sliceable_adaptor<ViewAdaptorT>;
+
+    template <class ViewAdaptorT>
+    using adaptor_for = view_adaptor<sliced_t<decltype(ViewAdaptorT::view)>, ViewAdaptorT::options>;
+};
+
+struct window_pushdown {
+    template <class ViewAdaptorT>
+    static constexpr bool enabled = adaptor<ViewAdaptorT>;
+
+    template <class ViewAdaptorT>
+    using adaptor_for = view_adaptor<windowed_t<decltype(ViewAdaptorT::view)>, ViewAdaptorT::options>;
+};
+
+struct reverse_pushdown {
+    template <class ViewAdaptorT>
+    static constexpr bool enabled = reversible_adaptor<ViewAdaptorT>;
+
+    template <class ViewAdaptorT>
+    using adaptor_for = view_adaptor<reversed_t<decltype(ViewAdaptorT::view)>, ViewAdaptorT::options>;
+};
+
+// returns a view of the elements in [first, last), which refers to the elements of the view
+template <class DiffT>
+struct slice_t : unary_protocol {
+    template <not_adaptor T>
+    static view_storage fn(T& self, DiffT first, DiffT last);
+
+    template <adaptor ViewAdaptorT>
+    [[nodiscard]] static constexpr view_storage fn(ViewAdaptorT& adaptor, DiffT first, DiffT last) {
+        if constexpr (slice_pushdown::enabled<ViewAdaptorT>) {
+            using adaptor_type = slice_pushdown::adaptor_for<ViewAdaptorT>;
+            return view_storage{adaptor_type{.view = sliced(adaptor.view, first, last)}};
+        } else {
+            unreachable();
+        }
+    }
+};
+
+// returns a view of the first count elements, which takes the view
+template <class DiffT>
+struct take_t : unary_protocol {
+    template <not_adaptor T>
+    static view_storage fn(T& self, DiffT count);
+
+    template <adaptor ViewAdaptorT>
+    [[nodiscard]] static constexpr view_storage fn(ViewAdaptorT& adaptor, DiffT count) {
+        using adaptor_type = window_pushdown::adaptor_for<ViewAdaptorT>;
+        using diff_type    = std::ranges::range_difference_t<decltype(adaptor_type::view)>;
+        return view_storage{
+            adaptor_type{.view = windowed(std::move(adaptor.view)).take(static_cast<diff_type>(count))}};
+    }
+};
+
+// returns a view of the elements after the first count elements, which takes the view
+template <class DiffT>
+struct drop_t : unary_protocol {
+    template <not_adaptor T>
+    static view_storage fn(T& self, DiffT count);
+
+    template <adaptor ViewAdaptorT>
+    [[nodiscard]] static constexpr view_storage fn(ViewAdaptorT& adaptor, DiffT count) {
+        using adaptor_type = window_pushdown::adaptor_for<ViewAdaptorT>;
+        using diff_type    = std::ranges::range_difference_t<decltype(adaptor_type::view)>;
+        return view_storage{
+            adaptor_type{.view = windowed(std::move(adaptor.view)).drop(static_cast<diff_type>(count))}};
+    }
+};
+
+// returns a view of the elements from the last to the first, which takes the view
+struct reverse_t : unary_protocol {
+    template <not_adaptor T>
+    static view_storage fn(T& self);
+
+    template <adaptor ViewAdaptorT>
+    [[nodiscard]] static constexpr view_storage fn(ViewAdaptorT& adaptor) {
+        if constexpr (reverse_pushdown::enabled<ViewAdaptorT>) {
+            using adaptor_type = reverse_pushdown::adaptor_for<ViewAdaptorT>;
+            return view_storage{adaptor_type{.view = reversed(std::move(adaptor.view))}};
+        } else {
+            unreachable();
+        }
+    }
+};
+
+template <class PushdownT, class RefT, class RValueRefT, class DiffT, class... ConstRefTs>
+struct pushdown_witness_t : nullary_protocol {
+    template <any_view_options OptsV>
+    using protocol_for = std::conditional_t<flag_is_set<OptsV, any_view_options::copyable>,
+                                            copyable_protocol<RefT, RValueRefT, DiffT, ConstRefTs...>,
+                                            uncopyable_protocol<RefT, RValueRefT, DiffT, ConstRefTs...>>;
+
+    // the protocols of the view are incomplete while this protocol is a part of them, so their witnesses are returned
+    // as the witnesses of their first protocols
+    struct witnesses_type {
+        const witness<move_t<view_storage>, view_storage>* witness_ptr;
+        const witness<unsized_protocol, view_storage>*     sized_witness_ptr;
+    };
+
+    template <not_adaptor>
+    static witnesses_type fn() noexcept;
+
+    template <adaptor ViewAdaptorT>
+    [[nodiscard]] static constexpr witnesses_type fn() noexcept {
+        if constexpr (PushdownT::template enabled<ViewAdaptorT>) {
+            using protocol_type       = protocol_for<ViewAdaptorT::options>;
+            using sized_protocol_type = decltype(get_sized_protocol<DiffT, ViewAdaptorT::options>());
+            using adaptor_type        = typename PushdownT::template adaptor_for<ViewAdaptorT>;
+            return {
+                .witness_ptr       = std::addressof(witness_for<protocol_type, view_storage, adaptor_type>),
+                .sized_witness_ptr = std::addressof(witness_for<sized_protocol_type, view_storage, adaptor_type>),
+            };
+        } else {
+            return {};
+        }
+    }
+};
+
 template <class ValueT, class RefT, class RValueRefT, class DiffT, any_view_options OptsV, class... ConstRefTs>
 consteval auto get_copyable_protocol();
 
@@ -76,9 +335,6 @@ struct const_copyable_witness_t : nullary_protocol {
     }
 };
 
-template <class DiffT, any_view_options OptsV>
-consteval auto get_sized_protocol();
-
 template <class ConstRefT, class ConstRValueRefT, class DiffT>
 struct const_sized_witness_t : nullary_protocol {
     template <any_view_options OptsV>
@@ -111,19 +367,33 @@ struct const_protocol<ConstRefT, ConstRValueRefT, DiffT>
     : inherit<const_copyable_witness_t<ConstRefT, ConstRValueRefT, DiffT>,
               const_sized_witness_t<ConstRefT, ConstRValueRefT, DiffT>> {};
 
+// begin and its iterator witness come first, followed by the entries for lifetime, traversal, pushdown and conversions
 template <class RefT, class RValueRefT, class DiffT, class... ConstRefTs>
-struct uncopyable_protocol : inherit<move_t<view_storage>,
-                                     destroy_t<view_storage>,
-                                     iterator_witness_t<RefT, RValueRefT, DiffT>,
+struct uncopyable_protocol : inherit<iterator_witness_t<RefT, RValueRefT, DiffT>,
                                      begin_t,
-                                     const_protocol<ConstRefTs..., DiffT>> {};
+                                     move_t<view_storage>,
+                                     destroy_t<view_storage>,
+                                     for_each_t<RefT>,
+                                     copy_to_t<RefT>,
+                                     move_to_t<RValueRefT>,
+                                     target_t,
+                                     slice_t<DiffT>,
+                                     take_t<DiffT>,
+                                     drop_t<DiffT>,
+                                     reverse_t,
+                                     pushdown_witness_t<slice_pushdown, RefT, RValueRefT, DiffT, ConstRefTs...>,
+                                     pushdown_witness_t<window_pushdown, RefT, RValueRefT, DiffT, ConstRefTs...>,
+                                     pushdown_witness_t<reverse_pushdown, RefT, RValueRefT, DiffT, ConstRefTs...>,
+                                     const_protocol<ConstRefTs..., DiffT>> {
+    using slice_witness_type   = pushdown_witness_t<slice_pushdown, RefT, RValueRefT, DiffT, ConstRefTs...>;
+    using window_witness_type  = pushdown_witness_t<window_pushdown, RefT, RValueRefT, DiffT, ConstRefTs...>;
+    using reverse_witness_type = pushdown_witness_t<reverse_pushdown, RefT, RValueRefT, DiffT, ConstRefTs...>;
+};
 
 template <class RefT, class RValueRefT, class DiffT, class... ConstRefTs>
 struct copyable_protocol : inherit<uncopyable_protocol<RefT, RValueRefT, DiffT, ConstRefTs...>, copy_t<view_storage>> {
 };
 
-struct unsized_protocol : inherit<> {};
-
 template <class DiffT>
 struct sized_protocol : inherit<unsized_protocol, reserve_hint_t<DiffT>> {};
 
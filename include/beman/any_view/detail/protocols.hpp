@@ -160,6 +160,19 @@ struct destroy_t : nullary_protocol {
     }
 };
 
+// also records whether the adaptor can be copied bitwise and need not be destroyed, so callers can skip dispatch
+template <storage StorageT>
+struct witness<destroy_t<StorageT>, StorageT> {
+    signature<destroy_t<StorageT>, StorageT>* entry;
+    bool                                      trivially_copyable;
+};
+
+template <storage StorageT, adaptor AdaptorT>
+inline constexpr witness<destroy_t<StorageT>, StorageT> witness_for<destroy_t<StorageT>, StorageT, AdaptorT>{
+    .entry              = dispatch<thunk<destroy_t<StorageT>, AdaptorT>, StorageT>,
+    .trivially_copyable = StorageT::template trivially_copyable<AdaptorT>,
+};
+
 } // namespace beman::any_view::detail
 
 #endif // BEMAN_ANY_VIEW_DETAIL_PROTOCOLS_HPP
@@ -0,0 +1,394 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_DETAIL_PUSHDOWN_VIEW_HPP
+#define BEMAN_ANY_VIEW_DETAIL_PUSHDOWN_VIEW_HPP
+
+#include <beman/any_view/reserve_hint.hpp>
+
+#include <algorithm>
+#include <compare>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace beman::any_view::detail {
+
+// the views below are sized when const if the views they adapt are, even though they are only iterable when mutable
+template <class ViewT>
+concept sized_view = requires(const ViewT& view) { std::ranges::size(view); };
+
+template <class ViewT>
+concept approximately_sized_view = requires(const ViewT& view) { beman::any_view::reserve_hint(view); };
+
+// owns ViewT and iterates it from its last element to its first
+template <std::ranges::view ViewT>
+    requires std::ranges::bidirectional_range<ViewT>
+class reversed_view : public std::ranges::view_interface<reversed_view<ViewT>> {
+    ViewT view;
+
+  public:
+    constexpr explicit reversed_view(ViewT view) : view(std::move(view)) {}
+
+    [[nodiscard]] constexpr ViewT base() && { return std::move(view); }
+
+    [[nodiscard]] constexpr auto begin() {
+        return std::make_reverse_iterator(std::ranges::next(std::ranges::begin(view), std::ranges::end(view)));
+    }
+
+    [[nodiscard]] constexpr auto end() { return std::make_reverse_iterator(std::ranges::begin(view)); }
+
+    [[nodiscard]] constexpr auto size() const
+        requires sized_view<ViewT>
+    {
+        return std::ranges::size(view);
+    }
+
+    [[nodiscard]] constexpr auto reserve_hint() const
+        requires approximately_sized_view<ViewT>
+    {
+        return beman::any_view::reserve_hint(view);
+    }
+};
+
+// reversing a reversed view or a view of reverse iterators restores the view it reverses, so reversing never nests
+template <std::ranges::view ViewT>
+    requires std::ranges::bidirectional_range<ViewT>
+[[nodiscard]] constexpr reversed_view<ViewT> reversed(ViewT view) {
+    return reversed_view<ViewT>(std::move(view));
+}
+
+template <class ViewT>
+[[nodiscard]] constexpr ViewT reversed(reversed_view<ViewT> view) {
+    return std::move(view).base();
+}
+
+template <std::random_access_iterator IterT, class SentinelT, std::ranges::subrange_kind KindV>
+[[nodiscard]] constexpr auto reversed(std::ranges::subrange<IterT, SentinelT, KindV> view) {
+    return std::ranges::subrange(std::make_reverse_iterator(std::ranges::next(view.begin(), view.end())),
+                                 std::make_reverse_iterator(view.begin()));
+}
+
+template <std::random_access_iterator IterT, std::ranges::subrange_kind KindV>
+[[nodiscard]] constexpr std::ranges::subrange<IterT>
+reversed(std::ranges::subrange<std::reverse_iterator<IterT>, std::reverse_iterator<IterT>, KindV> view) {
+    return {view.end().base(), view.begin().base()};
+}
+
+template <class ViewT>
+using reversed_t = decltype(reversed(std::declval<ViewT>()));
+
+template <class IterT>
+[[nodiscard]] consteval auto get_iterator_concept_of() {
+    if constexpr (std::contiguous_iterator<IterT>) {
+        return std::contiguous_iterator_tag{};
+    } else if constexpr (std::random_access_iterator<IterT>) {
+        return std::random_access_iterator_tag{};
+    } else if constexpr (std::bidirectional_iterator<IterT>) {
+        return std::bidirectional_iterator_tag{};
+    } else if constexpr (std::forward_iterator<IterT>) {
+        return std::forward_iterator_tag{};
+    } else {
+        return std::input_iterator_tag{};
+    }
+}
+
+// iterates at most count elements from IterT
+// unlike std::counted_iterator, it declares every member type, so that iterator traits never deduce them from its
+// operators, which is recursive in libstdc++ when the elements are views with std::unreachable_sentinel_t
+template <std::input_iterator IterT>
+class window_iterator {
+    IterT                          current{};
+    std::iter_difference_t<IterT> remaining = 0;
+
+  public:
+    using iterator_concept  = decltype(get_iterator_concept_of<IterT>());
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = std::iter_value_t<IterT>;
+    using difference_type   = std::iter_difference_t<IterT>;
+    using reference         = std::iter_reference_t<IterT>;
+    using pointer           = void;
+
+    constexpr window_iterator()
+        requires std::default_initializable<IterT>
+    = default;
+
+    constexpr window_iterator(IterT current, difference_type remaining)
+        : current(std::move(current)), remaining(remaining) {}
+
+    [[nodiscard]] constexpr const IterT& base() const noexcept { return current; }
+
+    [[nodiscard]] constexpr difference_type count() const noexcept { return remaining; }
+
+    [[nodiscard]] constexpr reference operator*() const
+        requires std::indirectly_readable<const IterT>
+    {
+        return *current;
+    }
+
+    [[nodiscard]] constexpr reference operator*() { return *current; }
+
+    [[nodiscard]] constexpr auto operator->() const
+        requires std::contiguous_iterator<IterT>
+    {
+        return std::to_address(current);
+    }
+
+    [[nodiscard]] constexpr reference operator[](difference_type n) const
+        requires std::random_access_iterator<IterT>
+    {
+        return current[n];
+    }
+
+    constexpr window_iterator& operator++() {
+        ++current;
+        --remaining;
+        return *this;
+    }
+
+    constexpr void operator++(int) { ++*this; }
+
+    constexpr window_iterator operator++(int)
+        requires std::forward_iterator<IterT>
+    {
+        auto other = *this;
+        ++*this;
+        return other;
+    }
+
+    constexpr window_iterator& operator--()
+        requires std::bidirectional_iterator<IterT>
+    {
+        --current;
+        ++remaining;
+        return *this;
+    }
+
+    constexpr window_iterator operator--(int)
+        requires std::bidirectional_iterator<IterT>
+    {
+        auto other = *this;
+        --*this;
+        return other;
+    }
+
+    constexpr window_iterator& operator+=(difference_type n)
+        requires std::random_access_iterator<IterT>
+    {
+        current += n;
+        remaining -= n;
+        return *this;
+    }
+
+    constexpr window_iterator& operator-=(difference_type n)
+        requires std::random_access_iterator<IterT>
+    {
+        return *this += -n;
+    }
+
+    [[nodiscard]] friend constexpr window_iterator operator+(window_iterator it, difference_type n)
+        requires std::random_access_iterator<IterT>
+    {
+        return it += n;
+    }
+
+    [[nodiscard]] friend constexpr window_iterator operator+(difference_type n, window_iterator it)
+        requires std::random_access_iterator<IterT>
+    {
+        return it += n;
+    }
+
+    [[nodiscard]] friend constexpr window_iterator operator-(window_iterator it, difference_type n)
+        requires std::random_access_iterator<IterT>
+    {
+        return it -= n;
+    }
+
+    [[nodiscard]] friend constexpr difference_type operator-(const window_iterator& lhs, const window_iterator& rhs)
+        requires std::random_access_iterator<IterT>
+    {
+        return rhs.remaining - lhs.remaining;
+    }
+
+    [[nodiscard]] friend constexpr std::iter_rvalue_reference_t<IterT>
+    iter_move(const window_iterator& it) noexcept(noexcept(std::ranges::iter_move(it.current))) {
+        return std::ranges::iter_move(it.current);
+    }
+
+    // iterators of a window compare by the elements that remain, like std::counted_iterator
+    [[nodiscard]] friend constexpr bool operator==(const window_iterator& lhs, const window_iterator& rhs)
+        requires std::forward_iterator<IterT>
+    {
+        return lhs.remaining == rhs.remaining;
+    }
+
+    [[nodiscard]] friend constexpr std::strong_ordering operator<=>(const window_iterator& lhs,
+                                                                    const window_iterator& rhs)
+        requires std::random_access_iterator<IterT>
+    {
+        return rhs.remaining <=> lhs.remaining;
+    }
+};
+
+template <class IterT, class SentinelT>
+struct window_sentinel {
+    SentinelT last;
+
+    [[nodiscard]] friend constexpr bool operator==(const window_iterator<IterT>& it, const window_sentinel& end) {
+        return it.count() == 0 or it.base() == end.last;
+    }
+
+    [[nodiscard]] friend constexpr std::iter_difference_t<IterT> operator-(const window_sentinel&        end,
+                                                                         const window_iterator<IterT>& it)
+        requires std::sized_sentinel_for<SentinelT, IterT>
+    {
+        return std::min(it.count(), static_cast<std::iter_difference_t<IterT>>(end.last - it.base()));
+    }
+
+    [[nodiscard]] friend constexpr std::iter_difference_t<IterT> operator-(const window_iterator<IterT>& it,
+                                                                         const window_sentinel&        end)
+        requires std::sized_sentinel_for<SentinelT, IterT>
+    {
+        return -(end - it);
+    }
+};
+
+// owns ViewT and iterates at most count of its elements, after skipping the first skip of them when iteration begins,
+// so that taking or dropping elements of a window makes another window of the same view
+// windows of random access and sized views iterate the iterators of the view, whose bounds are computed in O(1)
+template <std::ranges::view ViewT>
+class window_view : public std::ranges::view_interface<window_view<ViewT>> {
+    using iterator_type   = std::ranges::iterator_t<ViewT>;
+    using sentinel_type   = std::ranges::sentinel_t<ViewT>;
+    using difference_type = std::ranges::range_difference_t<ViewT>;
+    using size_type       = std::make_unsigned_t<difference_type>;
+
+    static constexpr difference_type unbounded = std::numeric_limits<difference_type>::max();
+
+    static constexpr bool random_access = std::ranges::random_access_range<ViewT> and std::ranges::sized_range<ViewT>;
+
+    ViewT           view;
+    difference_type skip  = 0;
+    difference_type count = unbounded;
+
+    [[nodiscard]] constexpr size_type length(difference_type size) const noexcept {
+        return static_cast<size_type>(std::min(std::max(size - skip, difference_type(0)), count));
+    }
+
+    [[nodiscard]] constexpr iterator_type skipped_begin() {
+        return std::ranges::begin(view) + std::min(skip, std::ranges::distance(view));
+    }
+
+  public:
+    constexpr explicit window_view(ViewT view) : view(std::move(view)) {}
+
+    [[nodiscard]] constexpr auto begin() {
+        if constexpr (random_access) {
+            return skipped_begin();
+        } else {
+            auto first = std::ranges::begin(view);
+            std::ranges::advance(first, skip, std::ranges::end(view));
+            return window_iterator<iterator_type>(std::move(first), count);
+        }
+    }
+
+    [[nodiscard]] constexpr auto end() {
+        if constexpr (random_access) {
+            return skipped_begin() + static_cast<difference_type>(length(std::ranges::distance(view)));
+        } else {
+            return window_sentinel<iterator_type, sentinel_type>{std::ranges::end(view)};
+        }
+    }
+
+    [[nodiscard]] constexpr size_type size() const
+        requires sized_view<ViewT>
+    {
+        return length(static_cast<difference_type>(std::ranges::size(view)));
+    }
+
+    [[nodiscard]] constexpr size_type reserve_hint() const
+        requires approximately_sized_view<ViewT>
+    {
+        return length(static_cast<difference_type>(beman::any_view::reserve_hint(view)));
+    }
+
+    [[nodiscard]] constexpr window_view take(difference_type n) && {
+        count = std::min(count, n);
+        return std::move(*this);
+    }
+
+    [[nodiscard]] constexpr window_view drop(difference_type n) && {
+        skip = std::min(skip, unbounded - n) + n;
+        if (count != unbounded) {
+            count -= std::min(count, n);
+        }
+        return std::move(*this);
+    }
+
+    // the window is resolved against the size of the view, which is traversed unless it is sized
+    [[nodiscard]] constexpr auto reverse() &&
+        requires std::ranges::bidirectional_range<ViewT>
+    {
+        const auto size  = static_cast<difference_type>(std::ranges::distance(view));
+        const auto first = std::min(skip, size);
+        const auto last  = first + std::min(count, size - first);
+        return window_view<reversed_t<ViewT>>(reversed(std::move(view))).drop(size - last).take(last - first);
+    }
+
+    // slices of a window refer to the elements of its view, so slicing never nests windows
+    [[nodiscard]] constexpr auto slice(difference_type first, difference_type last)
+        requires random_access
+    {
+        const auto begin = skipped_begin();
+        return std::ranges::subrange<iterator_type>(begin + first, begin + last);
+    }
+};
+
+template <class ViewT>
+    requires std::ranges::bidirectional_range<ViewT>
+[[nodiscard]] constexpr window_view<reversed_t<ViewT>> reversed(window_view<ViewT> view) {
+    return std::move(view).reverse();
+}
+
+template <std::ranges::view ViewT>
+[[nodiscard]] constexpr window_view<ViewT> windowed(ViewT view) {
+    return window_view<ViewT>(std::move(view));
+}
+
+template <class ViewT>
+[[nodiscard]] constexpr window_view<ViewT> windowed(window_view<ViewT> view) {
+    return view;
+}
+
+template <class ViewT>
+using windowed_t = decltype(windowed(std::declval<ViewT>()));
+
+template <std::ranges::random_access_range ViewT>
+[[nodiscard]] constexpr std::ranges::subrange<std::ranges::iterator_t<ViewT>>
+sliced(ViewT& view, std::ranges::range_difference_t<ViewT> first, std::ranges::range_difference_t<ViewT> last) {
+    const auto begin = std::ranges::begin(view);
+    return {begin + first, begin + last};
+}
+
+template <class ViewT>
+[[nodiscard]] constexpr auto sliced(window_view<ViewT>& view,
+                                    std::ranges::range_difference_t<ViewT> first,
+                                    std::ranges::range_difference_t<ViewT> last) {
+    return view.slice(first, last);
+}
+
+template <class ViewT>
+using sliced_t = decltype(sliced(std::declval<ViewT&>(), 0, 0));
+
+} // namespace beman::any_view::detail
+
+template <class ViewT>
+inline constexpr bool std::ranges::enable_borrowed_range<beman::any_view::detail::reversed_view<ViewT>> =
+    std::ranges::enable_borrowed_range<ViewT>;
+
+template <class ViewT>
+inline constexpr bool std::ranges::enable_borrowed_range<beman::any_view::detail::window_view<ViewT>> =
+    std::ranges::enable_borrowed_range<ViewT>;
+
+#endif // BEMAN_ANY_VIEW_DETAIL_PUSHDOWN_VIEW_HPP
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_DETAIL_SHARED_VIEW_HPP
+#define BEMAN_ANY_VIEW_DETAIL_SHARED_VIEW_HPP
+
+#include <beman/any_view/detail/no_unique_address.hpp>
+#include <beman/any_view/reserve_hint.hpp>
+
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace beman::any_view::detail {
+
+template <std::copy_constructible ViewT>
+[[nodiscard]] constexpr ViewT clone_view(const ViewT& view) {
+    return view;
+}
+
+// std::ranges::owning_view is move-only, but can be cloned by copying its range
+template <std::copy_constructible RangeT>
+[[nodiscard]] constexpr std::ranges::owning_view<RangeT> clone_view(const std::ranges::owning_view<RangeT>& view) {
+    return std::ranges::owning_view<RangeT>(RangeT(view.base()));
+}
+
+template <class ViewT>
+concept clonable_view = requires(const ViewT& view) { clone_view(view); };
+
+// shares ViewT between copies in O(1)
+// if ConstV, ViewT is only iterated as const and never cloned
+// otherwise, ViewT is cloned before it is iterated while shared
+template <std::ranges::view ViewT, bool ConstV, class AllocatorT>
+    requires ConstV or clonable_view<ViewT>
+class shared_view : public std::ranges::view_interface<shared_view<ViewT, ConstV, AllocatorT>> {
+    using base_type = std::conditional_t<ConstV, const ViewT, ViewT>;
+
+    std::shared_ptr<ViewT>                      base;
+    BEMAN_ANY_VIEW_NO_UNIQUE_ADDRESS AllocatorT allocator;
+
+    [[nodiscard]] constexpr base_type& unique_base() {
+        if constexpr (not ConstV) {
+            if (base.use_count() > 1) {
+                base = std::allocate_shared<ViewT>(allocator, clone_view(*base));
+            }
+        }
+
+        return *base;
+    }
+
+  public:
+    constexpr shared_view(ViewT view, const AllocatorT& allocator)
+        : base(std::allocate_shared<ViewT>(allocator, std::move(view))), allocator(allocator) {}
+
+    constexpr shared_view(const shared_view&) = default;
+
+    constexpr shared_view(shared_view&&) noexcept = default;
+
+    // allocators such as std::pmr::polymorphic_allocator are not assignable
+    constexpr shared_view& operator=(const shared_view& other) {
+        if (this != std::addressof(other)) {
+            std::destroy_at(this);
+            std::construct_at(this, other);
+        }
+
+        return *this;
+    }
+
+    constexpr shared_view& operator=(shared_view&& other) noexcept {
+        if (this != std::addressof(other)) {
+            std::destroy_at(this);
+            std::construct_at(this, std::move(other));
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] constexpr std::ranges::iterator_t<base_type> begin() { return std::ranges::begin(unique_base()); }
+
+    [[nodiscard]] constexpr std::ranges::sentinel_t<base_type> end() { return std::ranges::end(unique_base()); }
+
+    [[nodiscard]] constexpr auto size() const
+        requires std::ranges::sized_range<const ViewT>
+    {
+        return std::ranges::size(std::as_const(*base));
+    }
+
+    [[nodiscard]] constexpr auto reserve_hint() const
+        requires approximately_sized_range<const ViewT>
+    {
+        return beman::any_view::reserve_hint(std::as_const(*base));
+    }
+};
+
+} // namespace beman::any_view::detail
+
+template <class ViewT, bool ConstV, class AllocatorT>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<beman::any_view::detail::shared_view<ViewT, ConstV, AllocatorT>> =
+        std::ranges::enable_borrowed_range<ViewT>;
+
+#endif // BEMAN_ANY_VIEW_DETAIL_SHARED_VIEW_HPP
@@ -3,6 +3,7 @@
 #ifndef BEMAN_ANY_VIEW_DETAIL_SMALL_STORAGE_HPP
 #define BEMAN_ANY_VIEW_DETAIL_SMALL_STORAGE_HPP
 
+#include <beman/any_view/detail/spill.hpp>
 #include <beman/any_view/detail/witness.hpp>
 
 #include <cstddef>
@@ -30,7 +31,8 @@ class small_storage {
             *this,
             [&](inplace_type& inplace) { ::new (&inplace) AdaptorT(std::forward<AdaptorT>(adaptor)); },
             [&](pointer_type& pointer) {
-                std::construct_at(&pointer, ::new AdaptorT(std::forward<AdaptorT>(adaptor)));
+                std::construct_at(&pointer,
+                                  allocate<AdaptorT>(get_allocator(adaptor), std::forward<AdaptorT>(adaptor)));
             });
     }
 
@@ -39,7 +41,9 @@ class small_storage {
         visit<AdaptorT>(
             *this,
             [](inplace_type& inplace) { ::new (&inplace) AdaptorT(); },
-            [](pointer_type& pointer) { std::construct_at(&pointer, ::new AdaptorT()); });
+            [](pointer_type& pointer) {
+                std::construct_at(&pointer, allocate<AdaptorT>(allocator_type<AdaptorT>()));
+            });
     }
 
     template <adaptor AdaptorT>
@@ -50,7 +54,11 @@ class small_storage {
                 ::new (&inplace) AdaptorT(reinterpret_cast<const AdaptorT&>(other.inplace));
             },
             [&](pointer_type& pointer) {
-                std::construct_at(&pointer, ::new AdaptorT(static_cast<const AdaptorT&>(*other.pointer)));
+                const auto& other_adaptor = static_cast<const AdaptorT&>(*other.pointer);
+                std::construct_at(&pointer,
+                                  allocate<AdaptorT>(allocator_traits<AdaptorT>::select_on_container_copy_construction(
+                                                         get_allocator(other_adaptor)),
+                                                     other_adaptor));
             });
     }
 
@@ -67,7 +75,7 @@ class small_storage {
         visit<AdaptorT>(
             *this,
             [](inplace_type& inplace) { reinterpret_cast<AdaptorT&>(inplace).~AdaptorT(); },
-            [](pointer_type& pointer) { ::delete static_cast<AdaptorT*>(std::exchange(pointer, nullptr)); });
+            [](pointer_type& pointer) { deallocate(static_cast<AdaptorT*>(std::exchange(pointer, nullptr))); });
     }
 
     template <adaptor AdaptorT>
@@ -97,12 +105,80 @@ class small_storage {
     // template <adaptor AdaptorT>
     // [[nodiscard]] constexpr const AdaptorT&& unchecked_get() const&& noexcept;
 
+    template <adaptor AdaptorT>
+    static constexpr bool fits_inplace = sizeof(AdaptorT) <= sizeof(small_storage) and
+                                         alignof(AdaptorT) <= alignof(small_storage) and
+                                         std::is_nothrow_move_constructible_v<AdaptorT>;
+
+    // bitwise copies are only valid outside of constant evaluation, where AdaptorT is stored inplace
+    template <adaptor AdaptorT>
+    static constexpr bool trivially_copyable = fits_inplace<AdaptorT> and std::is_trivially_copyable_v<AdaptorT>;
+
   private:
+    // allocator-aware adaptors are allocated with a copy of their own allocator
+    template <adaptor AdaptorT>
+    struct allocator_for {
+        using type = std::allocator<AdaptorT>;
+    };
+
+    template <allocator_aware_adaptor AdaptorT>
+    struct allocator_for<AdaptorT> {
+        using type = typename std::allocator_traits<decltype(AdaptorT::allocator)>::template rebind_alloc<AdaptorT>;
+    };
+
+    template <adaptor AdaptorT>
+    using allocator_type = typename allocator_for<AdaptorT>::type;
+
+    template <adaptor AdaptorT>
+    using allocator_traits = std::allocator_traits<allocator_type<AdaptorT>>;
+
+    template <adaptor AdaptorT>
+    [[nodiscard]] static constexpr allocator_type<AdaptorT> get_allocator(const AdaptorT& adaptor) noexcept {
+        if constexpr (allocator_aware_adaptor<AdaptorT>) {
+            return allocator_type<AdaptorT>(adaptor.allocator);
+        } else {
+            return allocator_type<AdaptorT>();
+        }
+    }
+
+    template <adaptor AdaptorT, class... ArgsT>
+    [[nodiscard]] static constexpr pointer_type allocate(allocator_type<AdaptorT> allocator, ArgsT&&... args) {
+        using traits = allocator_traits<AdaptorT>;
+
+        if (not std::is_constant_evaluated()) {
+            report_spill<AdaptorT, sizeof(small_storage), alignof(small_storage)>();
+        }
+
+        AdaptorT* const ptr = std::to_address(traits::allocate(allocator, 1));
+
+        try {
+            traits::construct(allocator, ptr, std::forward<ArgsT>(args)...);
+        } catch (...) {
+            traits::deallocate(allocator, ptr, 1);
+            throw;
+        }
+
+        return ptr;
+    }
+
+    template <adaptor AdaptorT>
+    static constexpr void deallocate(AdaptorT* ptr) noexcept {
+        using traits = allocator_traits<AdaptorT>;
+
+        // moved-from storage holds a null pointer
+        if (ptr == nullptr) {
+            return;
+        }
+
+        auto allocator = get_allocator(*ptr);
+        traits::destroy(allocator, ptr);
+        traits::deallocate(allocator, ptr, 1);
+    }
+
     template <adaptor AdaptorT, class SelfT, class InplaceVisitorT, class PointerVisitorT>
     [[nodiscard]] static constexpr decltype(auto)
     visit(SelfT& self, InplaceVisitorT inplace_visitor, PointerVisitorT pointer_visitor) {
-        if constexpr (sizeof(AdaptorT) <= sizeof(small_storage) and alignof(AdaptorT) <= alignof(small_storage) and
-                      std::is_nothrow_move_constructible_v<AdaptorT>) {
+        if constexpr (fits_inplace<AdaptorT>) {
             if (not std::is_constant_evaluated()) {
                 return inplace_visitor(self.inplace);
             }
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_DETAIL_SPILL_HPP
+#define BEMAN_ANY_VIEW_DETAIL_SPILL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+
+namespace beman::any_view::detail {
+
+enum class spill_kind : unsigned char {
+    view,
+    iterator,
+};
+
+// describes an adaptor that is allocated because it does not fit inplace
+// adaptors that are not nothrow move constructible are allocated whatever their size
+struct spill_info {
+    spill_kind       kind;
+    std::string_view type_name;
+    std::size_t      size;
+    std::size_t      alignment;
+    bool             nothrow_move_constructible;
+    std::size_t      inplace_size;
+    std::size_t      inplace_alignment;
+};
+
+using spill_handler = void (*)(const spill_info&);
+
+inline std::atomic<spill_handler> global_spill_handler{nullptr};
+
+// invoked with every allocation of an adaptor from any thread, so it must be thread-safe and must not throw
+inline spill_handler set_spill_handler(spill_handler handler) noexcept {
+    return global_spill_handler.exchange(handler, std::memory_order_acq_rel);
+}
+
+[[nodiscard]] inline spill_handler get_spill_handler() noexcept {
+    return global_spill_handler.load(std::memory_order_acquire);
+}
+
+template <class AdaptorT, std::size_t SizeV, std::size_t AlignV>
+void report_spill() noexcept {
+    if (const auto handler = global_spill_handler.load(std::memory_order_relaxed)) {
+        // only adaptors of views have options
+        constexpr bool is_view = requires { AdaptorT::options; };
+
+        handler(spill_info{
+            .kind                       = is_view ? spill_kind::view : spill_kind::iterator,
+            .type_name                  = typeid(AdaptorT).name(),
+            .size                       = sizeof(AdaptorT),
+            .alignment                  = alignof(AdaptorT),
+            .nothrow_move_constructible = std::is_nothrow_move_constructible_v<AdaptorT>,
+            .inplace_size               = SizeV,
+            .inplace_alignment          = AlignV,
+        });
+    }
+}
+
+} // namespace beman::any_view::detail
+
+#endif // BEMAN_ANY_VIEW_DETAIL_SPILL_HPP
@@ -5,6 +5,7 @@
 
 #include <beman/any_view/detail/adaptors.hpp>
 
+#include <cstddef>
 #include <type_traits>
 
 namespace beman::any_view::detail {
@@ -78,14 +79,18 @@ inline constexpr witness<ProtocolT, StorageT> witness_for{
     .entry = dispatch<thunk<ProtocolT, AdaptorT>, StorageT>,
 };
 
+// witnesses of several entries start on a cache line, so that the entries listed first by their protocol share one
+inline constexpr std::size_t witness_alignment = 64;
+
 template <protocol... ProtocolTs, storage StorageT, adaptor AdaptorT>
-inline constexpr witness<inherit<ProtocolTs...>, StorageT> witness_for<inherit<ProtocolTs...>, StorageT, AdaptorT>{
-    witness_for<ProtocolTs, StorageT, AdaptorT>...,
-};
+alignas(witness_alignment) inline constexpr witness<inherit<ProtocolTs...>, StorageT>
+    witness_for<inherit<ProtocolTs...>, StorageT, AdaptorT>{
+        witness_for<ProtocolTs, StorageT, AdaptorT>...,
+    };
 
 template <protocol ProtocolT, storage StorageT, adaptor AdaptorT>
     requires derived_from_inherit<ProtocolT>
-inline constexpr witness<ProtocolT, StorageT> witness_for<ProtocolT, StorageT, AdaptorT>{
+alignas(witness_alignment) inline constexpr witness<ProtocolT, StorageT> witness_for<ProtocolT, StorageT, AdaptorT>{
     witness_for<inherit_type_t<ProtocolT>, StorageT, AdaptorT>,
 };
 
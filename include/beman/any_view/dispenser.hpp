@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_DISPENSER_HPP
+#define BEMAN_ANY_VIEW_DISPENSER_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace beman::any_view {
+
+// hands out chunks of the elements of an any_view to any number of threads, so that even an input view can be
+// consumed concurrently
+// each chunk takes the lock once and is moved into the buffer of its thread with a single dispatch
+template <class AnyViewT>
+class chunk_dispenser {
+    using rvalue_reference = std::ranges::range_rvalue_reference_t<AnyViewT>;
+    using polymorphic_type = decltype(detail::any_view_access::begin_polymorphic(std::declval<AnyViewT&>()));
+
+  public:
+    using value_type = std::ranges::range_value_t<AnyViewT>;
+    using chunk      = std::vector<value_type>;
+
+  private:
+    struct chunk_sink : detail::callable_base {
+        chunk& buffer;
+
+        explicit chunk_sink(chunk& buffer) noexcept : buffer(buffer) {}
+
+        void operator()(rvalue_reference ref) const { buffer.emplace_back(std::forward<rvalue_reference>(ref)); }
+    };
+
+    std::mutex                      mutex;
+    AnyViewT                        base;
+    std::optional<polymorphic_type> poly;
+    std::size_t                     chunk_size;
+    bool                            exhausted = false;
+
+  public:
+    explicit chunk_dispenser(AnyViewT base, std::size_t chunk_size) noexcept
+        : base(std::move(base)), chunk_size(chunk_size == 0 ? 1 : chunk_size) {}
+
+    // replaces the contents of buffer with the next chunk of up to chunk_size elements, reusing its capacity
+    // returns false once every element has been handed out, in which case buffer is left empty
+    bool next(chunk& buffer) {
+        buffer.clear();
+        buffer.reserve(chunk_size);
+
+        chunk_sink sink{buffer};
+
+        const std::scoped_lock lock{mutex};
+
+        if (exhausted) {
+            return false;
+        }
+
+        if (not poly) {
+            poly.emplace(detail::any_view_access::begin_polymorphic(base));
+        }
+
+        const auto size =
+            detail::dispatch<detail::move_batch_t<rvalue_reference>, polymorphic_type>(*poly, sink, chunk_size);
+        exhausted = size != chunk_size;
+
+        return size != 0;
+    }
+};
+
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+chunk_dispenser(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>, std::size_t)
+    -> chunk_dispenser<any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>>;
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_DISPENSER_HPP
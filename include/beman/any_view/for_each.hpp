@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_FOR_EACH_HPP
+#define BEMAN_ANY_VIEW_FOR_EACH_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+namespace beman::any_view {
+namespace detail {
+
+template <class RefT, class FunctionT>
+struct for_each_sink : callable_base {
+    FunctionT& function;
+
+    constexpr explicit for_each_sink(FunctionT& function) noexcept : function(function) {}
+
+    [[nodiscard]] constexpr bool operator()(RefT ref) const {
+        if constexpr (std::is_void_v<std::invoke_result_t<FunctionT&, RefT>>) {
+            std::invoke(function, std::forward<RefT>(ref));
+            return true;
+        } else {
+            return static_cast<bool>(std::invoke(function, std::forward<RefT>(ref)));
+        }
+    }
+};
+
+} // namespace detail
+
+// invokes function with each element of view, traversing it with a single dispatch
+// if function returns a value, traversal stops at the first element for which it converts to false
+// returns whether every element was visited
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT, class FunctionT>
+    requires std::invocable<FunctionT&, RefT>
+constexpr bool for_each(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view, FunctionT function) {
+    using polymorphic_type = std::remove_cvref_t<decltype(detail::any_view_access::polymorphic(view))>;
+
+    detail::for_each_sink<RefT, FunctionT> sink{function};
+    return detail::dispatch<detail::for_each_t<RefT>, polymorphic_type>(detail::any_view_access::polymorphic(view),
+                                                                        sink);
+}
+
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT, class FunctionT>
+    requires std::invocable<FunctionT&, RefT>
+constexpr bool for_each(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>&& view, FunctionT function) {
+    return beman::any_view::for_each(view, std::move(function));
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_FOR_EACH_HPP
@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_GENERATOR_HPP
+#define BEMAN_ANY_VIEW_GENERATOR_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <array>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace beman::any_view {
+namespace detail {
+
+// recycles coroutine frames on the thread that frees them, so that a coroutine per request does not reach the global
+// allocator once the pool of its size class is warm
+class frame_pool {
+    static constexpr std::size_t granularity  = 64;
+    static constexpr std::size_t class_count  = 16;
+    static constexpr std::size_t max_retained = 16;
+
+    struct free_frame {
+        free_frame* next;
+    };
+
+    struct size_class {
+        free_frame* head;
+        std::size_t count;
+    };
+
+    // trivially destructible, so that its storage outlives every other thread local object of the thread
+    struct state {
+        std::array<size_class, class_count> classes;
+        bool                                closed;
+    };
+
+    static state& local() noexcept {
+        thread_local constinit state local_state{};
+        return local_state;
+    }
+
+    // frees retained frames when the thread exits, after which frames are freed immediately
+    struct cleanup {
+        ~cleanup() {
+            auto& pool  = local();
+            pool.closed = true;
+
+            for (std::size_t index = 0; index != class_count; ++index) {
+                for (auto frame = pool.classes[index].head; frame != nullptr;) {
+                    ::operator delete(std::exchange(frame, frame->next), (index + 1) * granularity);
+                }
+                pool.classes[index] = {};
+            }
+        }
+    };
+
+    [[nodiscard]] static constexpr std::size_t class_index(std::size_t size) noexcept {
+        return (size + granularity - 1) / granularity - 1;
+    }
+
+  public:
+    [[nodiscard]] static void* allocate(std::size_t size) {
+        const auto index = class_index(size);
+
+        if (index >= class_count) {
+            return ::operator new(size);
+        }
+
+        auto& pool = local();
+
+        if (auto& frames = pool.classes[index]; frames.head != nullptr) {
+            --frames.count;
+            return std::exchange(frames.head, frames.head->next);
+        }
+
+        thread_local cleanup registration;
+        return ::operator new((index + 1) * granularity);
+    }
+
+    static void deallocate(void* ptr, std::size_t size) noexcept {
+        const auto index = class_index(size);
+
+        if (index >= class_count) {
+            ::operator delete(ptr, size);
+            return;
+        }
+
+        auto& pool   = local();
+        auto& frames = pool.classes[index];
+
+        if (pool.closed or frames.count == max_retained) {
+            ::operator delete(ptr, (index + 1) * granularity);
+            return;
+        }
+
+        frames.head = ::new (ptr) free_frame{frames.head};
+        ++frames.count;
+    }
+};
+
+} // namespace detail
+
+// input view of the values yielded by a coroutine, which can be type erased into any_view<T> without allocating
+// each element is referred to in the coroutine frame as T&, and coroutine frames are recycled by a per-thread pool
+template <class T>
+    requires(not std::is_reference_v<T>)
+class generator : public std::ranges::view_interface<generator<T>> {
+  public:
+    using value_type = std::remove_cv_t<T>;
+    using reference  = T&;
+
+    class promise_type {
+        std::add_pointer_t<T>     value_ptr = nullptr;
+        std::optional<value_type> converted;
+        std::exception_ptr        exception;
+
+        friend class generator;
+
+      public:
+        [[nodiscard]] generator get_return_object() noexcept {
+            return generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+        [[nodiscard]] std::suspend_always final_suspend() const noexcept { return {}; }
+
+        // the operand of co_yield lives until the coroutine is resumed, even if it is a temporary
+        std::suspend_always yield_value(T& value) noexcept {
+            value_ptr = std::addressof(value);
+            return {};
+        }
+
+        std::suspend_always yield_value(value_type&& value) noexcept {
+            value_ptr = std::addressof(value);
+            return {};
+        }
+
+        template <class U>
+            requires(not std::same_as<std::remove_cvref_t<U>, value_type>) and std::constructible_from<value_type, U>
+        std::suspend_always yield_value(U&& value) {
+            value_ptr = std::addressof(converted.emplace(std::forward<U>(value)));
+            return {};
+        }
+
+        template <class U>
+        void await_transform(U&&) = delete;
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+        [[nodiscard]] static void* operator new(std::size_t size) { return detail::frame_pool::allocate(size); }
+
+        static void operator delete(void* ptr, std::size_t size) noexcept {
+            detail::frame_pool::deallocate(ptr, size);
+        }
+    };
+
+  private:
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    handle_type handle;
+
+    explicit generator(handle_type handle) noexcept : handle(handle) {}
+
+    static void resume(handle_type handle) {
+        handle.resume();
+
+        if (auto& exception = handle.promise().exception) {
+            std::rethrow_exception(std::exchange(exception, nullptr));
+        }
+    }
+
+  public:
+    class iterator {
+        handle_type handle;
+
+      public:
+        using value_type      = generator::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        explicit iterator(handle_type handle) noexcept : handle(handle) {}
+
+        iterator(iterator&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+        iterator& operator=(iterator&& other) noexcept {
+            handle = std::exchange(other.handle, nullptr);
+            return *this;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return *handle.promise().value_ptr; }
+
+        iterator& operator++() {
+            generator::resume(handle);
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept { return handle.done(); }
+    };
+
+    generator() noexcept = default;
+
+    generator(generator&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+    generator& operator=(generator other) noexcept {
+        std::swap(handle, other.handle);
+        return *this;
+    }
+
+    ~generator() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    // runs the coroutine until its first co_yield, so it must be called at most once
+    [[nodiscard]] iterator begin() {
+        resume(handle);
+        return iterator{handle};
+    }
+
+    [[nodiscard]] std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_GENERATOR_HPP
@@ -0,0 +1,435 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_INSTRUMENT_HPP
+#define BEMAN_ANY_VIEW_INSTRUMENT_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace beman::any_view {
+
+// operations on an instrumented stage, named after the protocols they dispatch into the erased view or its iterators
+enum class stage_operation : unsigned char {
+    begin,
+    size,
+    copy,
+    iterator_copy,
+    dereference,
+    iter_move,
+    next,
+    prev,
+    advance,
+    sentinel_compare,
+    equality_compare,
+    three_way_compare,
+    subtract,
+};
+
+inline constexpr std::size_t stage_operation_count = 13;
+inline constexpr std::size_t latency_bucket_count  = 64;
+
+// bucket i counts the latencies of std::bit_width(i) nanoseconds, that is in [2^(i-1), 2^i) and 0 for bucket 0
+struct latency_histogram {
+    std::array<std::uint64_t, latency_bucket_count> buckets{};
+
+    [[nodiscard]] std::uint64_t total() const noexcept {
+        std::uint64_t sum = 0;
+
+        for (const auto bucket : buckets) {
+            sum += bucket;
+        }
+
+        return sum;
+    }
+};
+
+// everything recorded for a stage from its creation by instrument to the destruction of its last copy
+// element_latency records the time spent dereferencing an element and then incrementing past it
+struct stage_profile {
+    std::string_view                                 label;
+    std::array<std::uint64_t, stage_operation_count> counts{};
+    latency_histogram                                begin_latency;
+    latency_histogram                                element_latency;
+
+    [[nodiscard]] std::uint64_t count(stage_operation operation) const noexcept {
+        return counts[static_cast<std::size_t>(operation)];
+    }
+};
+
+using profile_handler = void (*)(const stage_profile&);
+
+namespace detail {
+
+inline std::atomic<profile_handler> global_profile_handler{nullptr};
+
+using profile_clock = std::chrono::steady_clock;
+
+// adds the time elapsed during its lifetime to total
+class stopwatch {
+    profile_clock::duration&  total;
+    profile_clock::time_point start = profile_clock::now();
+
+  public:
+    explicit stopwatch(profile_clock::duration& total) noexcept : total(total) {}
+
+    stopwatch(const stopwatch&) = delete;
+
+    stopwatch& operator=(const stopwatch&) = delete;
+
+    ~stopwatch() { total += profile_clock::now() - start; }
+};
+
+// counters of a stage shared by its copies and iterators, which may update them from several threads
+class stage_stats {
+    using counter = std::atomic<std::uint64_t>;
+
+    std::string                                label;
+    std::array<counter, stage_operation_count> counts{};
+    std::array<counter, latency_bucket_count>  begin_buckets{};
+    std::array<counter, latency_bucket_count>  element_buckets{};
+
+    static void record(std::array<counter, latency_bucket_count>& buckets, profile_clock::duration latency) noexcept {
+        const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count();
+        const auto bucket      = std::bit_width(static_cast<std::uint64_t>(nanoseconds < 0 ? 0 : nanoseconds));
+
+        buckets[bucket < latency_bucket_count ? bucket : latency_bucket_count - 1].fetch_add(
+            1, std::memory_order_relaxed);
+    }
+
+    static latency_histogram snapshot(const std::array<counter, latency_bucket_count>& buckets) noexcept {
+        latency_histogram histogram;
+
+        for (std::size_t i = 0; i < latency_bucket_count; ++i) {
+            histogram.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+        }
+
+        return histogram;
+    }
+
+  public:
+    explicit stage_stats(std::string label) noexcept : label(std::move(label)) {}
+
+    stage_stats(const stage_stats&) = delete;
+
+    stage_stats& operator=(const stage_stats&) = delete;
+
+    // reports to the handler registered when the last copy of the stage is destroyed, if any
+    ~stage_stats() {
+        if (const auto handler = global_profile_handler.load(std::memory_order_acquire)) {
+            stage_profile profile{.label           = label,
+                                  .begin_latency   = snapshot(begin_buckets),
+                                  .element_latency = snapshot(element_buckets)};
+
+            for (std::size_t i = 0; i < stage_operation_count; ++i) {
+                profile.counts[i] = counts[i].load(std::memory_order_relaxed);
+            }
+
+            handler(profile);
+        }
+    }
+
+    void count(stage_operation operation) noexcept {
+        counts[static_cast<std::size_t>(operation)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_begin(profile_clock::duration latency) noexcept { record(begin_buckets, latency); }
+
+    void record_element(profile_clock::duration latency) noexcept { record(element_buckets, latency); }
+};
+
+// forwards every operation to IterT after counting it, and times each element from its dereference to the increment
+// past it
+template <std::input_iterator IterT>
+class instrumented_iterator {
+    IterT                           base{};
+    stage_stats*                    stats = nullptr;
+    mutable profile_clock::duration pending{};
+
+    void count(stage_operation operation) const noexcept { stats->count(operation); }
+
+  public:
+    using iterator_concept  = decltype(get_iterator_concept_of<IterT>());
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = std::iter_value_t<IterT>;
+    using difference_type   = std::iter_difference_t<IterT>;
+    using reference         = std::iter_reference_t<IterT>;
+
+    instrumented_iterator()
+        requires std::default_initializable<IterT>
+    = default;
+
+    instrumented_iterator(IterT base, stage_stats& stats) noexcept(std::is_nothrow_move_constructible_v<IterT>)
+        : base(std::move(base)), stats(std::addressof(stats)) {}
+
+    instrumented_iterator(const instrumented_iterator& other)
+        requires std::copy_constructible<IterT>
+        : base(other.base), stats(other.stats) {
+        if (stats != nullptr) {
+            count(stage_operation::iterator_copy);
+        }
+    }
+
+    instrumented_iterator(instrumented_iterator&&) noexcept = default;
+
+    instrumented_iterator& operator=(const instrumented_iterator& other)
+        requires std::copyable<IterT>
+    {
+        base  = other.base;
+        stats = other.stats;
+
+        if (stats != nullptr) {
+            count(stage_operation::iterator_copy);
+        }
+
+        return *this;
+    }
+
+    instrumented_iterator& operator=(instrumented_iterator&&) noexcept = default;
+
+    [[nodiscard]] reference operator*() const {
+        count(stage_operation::dereference);
+        const stopwatch watch{pending};
+        return *base;
+    }
+
+    [[nodiscard]] auto operator->() const
+        requires std::contiguous_iterator<IterT>
+    {
+        count(stage_operation::dereference);
+        return std::to_address(base);
+    }
+
+    instrumented_iterator& operator++() {
+        count(stage_operation::next);
+        {
+            const stopwatch watch{pending};
+            ++base;
+        }
+        stats->record_element(std::exchange(pending, profile_clock::duration{}));
+        return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    [[nodiscard]] instrumented_iterator operator++(int)
+        requires std::forward_iterator<IterT>
+    {
+        auto other = *this;
+        ++*this;
+        return other;
+    }
+
+    instrumented_iterator& operator--()
+        requires std::bidirectional_iterator<IterT>
+    {
+        count(stage_operation::prev);
+        --base;
+        return *this;
+    }
+
+    [[nodiscard]] instrumented_iterator operator--(int)
+        requires std::bidirectional_iterator<IterT>
+    {
+        auto other = *this;
+        --*this;
+        return other;
+    }
+
+    instrumented_iterator& operator+=(difference_type offset)
+        requires std::random_access_iterator<IterT>
+    {
+        count(stage_operation::advance);
+        base += offset;
+        return *this;
+    }
+
+    instrumented_iterator& operator-=(difference_type offset)
+        requires std::random_access_iterator<IterT>
+    {
+        count(stage_operation::advance);
+        base -= offset;
+        return *this;
+    }
+
+    [[nodiscard]] instrumented_iterator operator+(difference_type offset) const
+        requires std::random_access_iterator<IterT>
+    {
+        auto other = *this;
+        return other += offset;
+    }
+
+    [[nodiscard]] friend instrumented_iterator operator+(difference_type offset, const instrumented_iterator& other)
+        requires std::random_access_iterator<IterT>
+    {
+        return other + offset;
+    }
+
+    [[nodiscard]] instrumented_iterator operator-(difference_type offset) const
+        requires std::random_access_iterator<IterT>
+    {
+        auto other = *this;
+        return other -= offset;
+    }
+
+    [[nodiscard]] reference operator[](difference_type offset) const
+        requires std::random_access_iterator<IterT>
+    {
+        count(stage_operation::dereference);
+        return base[offset];
+    }
+
+    [[nodiscard]] bool operator==(const instrumented_iterator& other) const
+        requires std::forward_iterator<IterT>
+    {
+        count(stage_operation::equality_compare);
+        return base == other.base;
+    }
+
+    [[nodiscard]] auto operator<=>(const instrumented_iterator& other) const
+        requires std::random_access_iterator<IterT>
+    {
+        count(stage_operation::three_way_compare);
+        return base <=> other.base;
+    }
+
+    [[nodiscard]] difference_type operator-(const instrumented_iterator& other) const
+        requires std::sized_sentinel_for<IterT, IterT>
+    {
+        count(stage_operation::subtract);
+        return base - other.base;
+    }
+
+    [[nodiscard]] bool operator==(std::default_sentinel_t) const {
+        count(stage_operation::sentinel_compare);
+        return base == std::default_sentinel;
+    }
+
+    [[nodiscard]] friend difference_type operator-(std::default_sentinel_t, const instrumented_iterator& other)
+        requires std::sized_sentinel_for<std::default_sentinel_t, IterT>
+    {
+        other.count(stage_operation::subtract);
+        return std::default_sentinel - other.base;
+    }
+
+    [[nodiscard]] friend difference_type operator-(const instrumented_iterator& other, std::default_sentinel_t)
+        requires std::sized_sentinel_for<std::default_sentinel_t, IterT>
+    {
+        other.count(stage_operation::subtract);
+        return other.base - std::default_sentinel;
+    }
+
+    [[nodiscard]] friend std::iter_rvalue_reference_t<IterT> iter_move(const instrumented_iterator& other) {
+        other.count(stage_operation::iter_move);
+        return std::ranges::iter_move(other.base);
+    }
+};
+
+// view of the elements of an any_view that counts and times the operations on it into stage_stats shared by its copies
+template <class AnyViewT>
+class instrumented_view : public std::ranges::view_interface<instrumented_view<AnyViewT>> {
+    using iterator = instrumented_iterator<std::ranges::iterator_t<AnyViewT>>;
+
+    // the size of an any_view is dispatched to the const size of the view it erases, though it is not const itself
+    mutable AnyViewT             base;
+    std::shared_ptr<stage_stats> stats;
+
+  public:
+    instrumented_view(AnyViewT base, std::string label)
+        : base(std::move(base)), stats(std::make_shared<stage_stats>(std::move(label))) {}
+
+    instrumented_view(const instrumented_view& other)
+        requires std::copy_constructible<AnyViewT>
+        : base(other.base), stats(other.stats) {
+        if (stats) {
+            stats->count(stage_operation::copy);
+        }
+    }
+
+    instrumented_view(instrumented_view&&) noexcept = default;
+
+    instrumented_view& operator=(const instrumented_view& other)
+        requires std::copyable<AnyViewT>
+    {
+        base  = other.base;
+        stats = other.stats;
+
+        if (stats) {
+            stats->count(stage_operation::copy);
+        }
+
+        return *this;
+    }
+
+    instrumented_view& operator=(instrumented_view&&) noexcept = default;
+
+    [[nodiscard]] iterator begin() {
+        stats->count(stage_operation::begin);
+
+        profile_clock::duration latency{};
+        auto                    first = [&] {
+            const stopwatch watch{latency};
+            return std::ranges::begin(base);
+        }();
+
+        stats->record_begin(latency);
+        return iterator{std::move(first), *stats};
+    }
+
+    [[nodiscard]] std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    [[nodiscard]] auto size() const
+        requires std::ranges::sized_range<AnyViewT>
+    {
+        stats->count(stage_operation::size);
+        return std::ranges::size(base);
+    }
+
+    [[nodiscard]] auto reserve_hint() const
+        requires approximately_sized_range<AnyViewT>
+    {
+        stats->count(stage_operation::size);
+        return beman::any_view::reserve_hint(base);
+    }
+};
+
+} // namespace detail
+
+// registers the handler invoked with the profile of every instrumented stage when its last copy is destroyed
+// it may be invoked from any thread, so it must be thread-safe and must not throw
+inline profile_handler set_profile_handler(profile_handler handler) noexcept {
+    return detail::global_profile_handler.exchange(handler, std::memory_order_acq_rel);
+}
+
+[[nodiscard]] inline profile_handler get_profile_handler() noexcept {
+    return detail::global_profile_handler.load(std::memory_order_acquire);
+}
+
+// returns a view of the elements of view, labelled as a stage of a pipeline, which counts every operation on it and
+// its iterators and records the latency of begin and of each element, until its last copy is destroyed
+// the counters live as long as the copies of the view, so its iterators must not outlive them and it is never borrowed
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+    requires(not detail::flag_is_set<OptsV, any_view_options::borrowed>)
+[[nodiscard]] any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>
+instrument(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT> view, std::string label) {
+    using view_type = any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>;
+
+    return view_type{detail::instrumented_view<view_type>{std::move(view), std::move(label)}};
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_INSTRUMENT_HPP
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_PARALLEL_HPP
+#define BEMAN_ANY_VIEW_PARALLEL_HPP
+
+#include <beman/any_view/for_each.hpp>
+#include <beman/any_view/slice.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace beman::any_view {
+namespace detail {
+
+[[nodiscard]] inline std::size_t default_thread_count() noexcept {
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// invokes function with each of up to thread_count slices of view and its index, on its own thread
+// the last slice is traversed on the calling thread, and the first exception thrown by any slice is rethrown
+template <class AnyViewT, class FunctionT>
+void parallel_slices(AnyViewT& view, std::size_t thread_count, FunctionT function) {
+    using difference_type = std::ranges::range_difference_t<AnyViewT>;
+
+    const auto size  = static_cast<std::size_t>(std::ranges::size(view));
+    const auto count = std::max<std::size_t>(std::min(thread_count, size), 1);
+
+    std::vector<std::exception_ptr> exceptions(count);
+
+    const auto run = [&](std::size_t index, AnyViewT slice) {
+        try {
+            std::invoke(function, index, std::move(slice));
+        } catch (...) {
+            exceptions[index] = std::current_exception();
+        }
+    };
+
+    const auto bound = [&](std::size_t index) { return static_cast<difference_type>(size * index / count); };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(count - 1);
+
+        for (std::size_t index = 0; index != count - 1; ++index) {
+            threads.emplace_back(run, index, detail::any_view_access::slice(view, bound(index), bound(index + 1)));
+        }
+
+        run(count - 1, detail::any_view_access::slice(view, bound(count - 1), bound(count)));
+    }
+
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+} // namespace detail
+
+// invokes a copy of function with each element of view on each of up to thread_count threads
+// view is partitioned into a slice per thread, each of which is traversed with a single dispatch
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT, class FunctionT>
+    requires(detail::flag_is_set<OptsV, any_view_options::random_access | any_view_options::sized>) and
+            std::invocable<FunctionT&, RefT> and std::copy_constructible<FunctionT>
+void parallel_for_each(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view,
+                       FunctionT                                           function,
+                       std::size_t thread_count = detail::default_thread_count()) {
+    detail::parallel_slices(view, thread_count, [&](std::size_t, auto slice) {
+        beman::any_view::for_each(slice, [function](RefT ref) mutable {
+            std::invoke(function, std::forward<RefT>(ref));
+        });
+    });
+}
+
+// returns init combined with each element of view in unspecified order and grouping, like std::reduce
+// each slice of view is reduced on its own thread, and the results are combined on the calling thread
+template <class ElementT,
+          any_view_options OptsV,
+          class RefT,
+          class RValueRefT,
+          class DiffT,
+          std::move_constructible T,
+          class BinaryOpT>
+    requires(detail::flag_is_set<OptsV, any_view_options::random_access | any_view_options::sized>) and
+            std::constructible_from<T, RefT> and std::copy_constructible<BinaryOpT> and
+            std::is_invocable_r_v<T, BinaryOpT&, T, RefT> and std::is_invocable_r_v<T, BinaryOpT&, T, T>
+[[nodiscard]] T parallel_reduce(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view,
+                                T                                                   init,
+                                BinaryOpT                                           op,
+                                std::size_t thread_count = detail::default_thread_count()) {
+    std::vector<std::optional<T>> results(std::max<std::size_t>(thread_count, 1));
+
+    detail::parallel_slices(view, thread_count, [&](std::size_t index, auto slice) {
+        auto  slice_op = op;
+        auto& result   = results[index];
+
+        beman::any_view::for_each(slice, [&](RefT ref) {
+            if (result) {
+                result.emplace(std::invoke(slice_op, std::move(*result), std::forward<RefT>(ref)));
+            } else {
+                result.emplace(std::forward<RefT>(ref));
+            }
+        });
+    });
+
+    for (auto& result : results) {
+        if (result) {
+            init = std::invoke(op, std::move(init), std::move(*result));
+        }
+    }
+
+    return init;
+}
+
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT, class T>
+    requires(detail::flag_is_set<OptsV, any_view_options::random_access | any_view_options::sized>) and
+            std::constructible_from<T, RefT>
+[[nodiscard]] T parallel_reduce(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view, T init) {
+    return beman::any_view::parallel_reduce(view, std::move(init), std::plus<>{});
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_PARALLEL_HPP
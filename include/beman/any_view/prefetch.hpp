@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_PREFETCH_HPP
+#define BEMAN_ANY_VIEW_PREFETCH_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <semaphore>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace beman::any_view {
+namespace detail {
+
+inline constexpr std::size_t default_prefetch_batch_size = 64;
+inline constexpr std::size_t default_prefetch_depth      = 4;
+
+// ring of batches filled by a background thread from an any_view and drained by a single consumer
+// a semaphore of free slots and a semaphore of filled slots hand each batch over without a lock, and an empty batch
+// marks the end of the elements
+template <class AnyViewT>
+class prefetch_ring {
+    using rvalue_reference = std::ranges::range_rvalue_reference_t<AnyViewT>;
+    using polymorphic_type = decltype(any_view_access::begin_polymorphic(std::declval<AnyViewT&>()));
+
+  public:
+    using value_type = std::ranges::range_value_t<AnyViewT>;
+    using batch      = std::vector<value_type>;
+
+  private:
+    struct batch_sink : callable_base {
+        batch& buffer;
+
+        explicit batch_sink(batch& buffer) noexcept : buffer(buffer) {}
+
+        void operator()(rvalue_reference ref) const { buffer.emplace_back(std::forward<rvalue_reference>(ref)); }
+    };
+
+    AnyViewT                  base;
+    std::vector<batch>        slots;
+    std::size_t               batch_size;
+    std::size_t               consumed = 0;
+    std::counting_semaphore<> free_slots;
+    std::counting_semaphore<> filled_slots{0};
+    std::exception_ptr        exception;
+    std::jthread              producer;
+
+    void produce(const std::stop_token& token) {
+        std::optional<polymorphic_type> poly;
+        bool                            exhausted = false;
+
+        for (std::size_t produced = 0;; ++produced) {
+            free_slots.acquire();
+
+            if (token.stop_requested()) {
+                return;
+            }
+
+            auto& buffer = slots[produced % slots.size()];
+            buffer.clear();
+
+            // a partial batch is followed by an empty one, without asking the exhausted view again
+            if (not exhausted) {
+                try {
+                    if (not poly) {
+                        poly.emplace(any_view_access::begin_polymorphic(base));
+                    }
+
+                    buffer.reserve(batch_size);
+
+                    batch_sink sink{buffer};
+                    exhausted = dispatch<move_batch_t<rvalue_reference>, polymorphic_type>(*poly, sink, batch_size) !=
+                                batch_size;
+                } catch (...) {
+                    exception = std::current_exception();
+                    buffer.clear();
+                }
+            }
+
+            const bool last = buffer.empty();
+            filled_slots.release();
+
+            if (last) {
+                return;
+            }
+        }
+    }
+
+  public:
+    prefetch_ring(AnyViewT base, std::size_t batch_size, std::size_t depth)
+        : base(std::move(base)),
+          slots(depth == 0 ? 1 : depth),
+          batch_size(batch_size == 0 ? 1 : batch_size),
+          free_slots(static_cast<std::ptrdiff_t>(slots.size())) {}
+
+    prefetch_ring(const prefetch_ring&) = delete;
+
+    prefetch_ring& operator=(const prefetch_ring&) = delete;
+
+    // wakes the producer if it is waiting for a free slot, before it is joined
+    ~prefetch_ring() {
+        if (producer.joinable()) {
+            producer.request_stop();
+            free_slots.release();
+        }
+    }
+
+    void start() {
+        producer = std::jthread{[this](std::stop_token token) { produce(token); }};
+    }
+
+    // releases the batch that was being read, if any, and waits for the next one
+    // returns nullptr once every element has been read, after rethrowing the exception of the producer if any
+    [[nodiscard]] batch* next(bool release) {
+        if (release) {
+            free_slots.release();
+        }
+
+        filled_slots.acquire();
+
+        if (auto& buffer = slots[consumed++ % slots.size()]; not buffer.empty()) {
+            return std::addressof(buffer);
+        }
+
+        if (exception) {
+            std::rethrow_exception(std::exchange(exception, nullptr));
+        }
+
+        return nullptr;
+    }
+};
+
+// input view of the elements of an any_view, which are read ahead in batches on a background thread started by begin
+template <class AnyViewT>
+class prefetch_view : public std::ranges::view_interface<prefetch_view<AnyViewT>> {
+    using ring_type = prefetch_ring<AnyViewT>;
+
+    std::unique_ptr<ring_type> ring;
+
+  public:
+    using value_type = typename ring_type::value_type;
+
+    class iterator {
+      public:
+        using value_type      = prefetch_view::value_type;
+        using difference_type = std::ranges::range_difference_t<AnyViewT>;
+
+      private:
+        ring_type*  ring     = nullptr;
+        value_type* position = nullptr;
+        value_type* last     = nullptr;
+
+        void acquire(bool release) {
+            if (const auto batch = ring->next(release)) {
+                position = batch->data();
+                last     = position + batch->size();
+            } else {
+                position = last = nullptr;
+            }
+        }
+
+      public:
+        explicit iterator(ring_type& ring) : ring(std::addressof(ring)) { acquire(false); }
+
+        iterator(iterator&& other) noexcept
+            : ring(other.ring), position(std::exchange(other.position, nullptr)),
+              last(std::exchange(other.last, nullptr)) {}
+
+        iterator& operator=(iterator&& other) noexcept {
+            ring     = other.ring;
+            position = std::exchange(other.position, nullptr);
+            last     = std::exchange(other.last, nullptr);
+            return *this;
+        }
+
+        [[nodiscard]] value_type& operator*() const noexcept { return *position; }
+
+        iterator& operator++() {
+            if (++position == last) {
+                acquire(true);
+            }
+
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept { return position == nullptr; }
+    };
+
+    prefetch_view(AnyViewT base, std::size_t batch_size, std::size_t depth)
+        : ring(std::make_unique<ring_type>(std::move(base), batch_size, depth)) {}
+
+    // starts the background thread, so it must be called at most once
+    [[nodiscard]] iterator begin() {
+        ring->start();
+        return iterator{*ring};
+    }
+
+    [[nodiscard]] std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
+} // namespace detail
+
+// returns an input view of the elements of view, which are moved on a background thread into a ring of up to depth
+// batches of batch_size elements while earlier batches are consumed, so that slow reads overlap with processing
+// the background thread is started by begin and stopped by the destruction of the returned view
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+    requires std::move_constructible<std::ranges::range_value_t<any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>>>
+[[nodiscard]] auto prefetch(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT> view,
+                            std::size_t batch_size = detail::default_prefetch_batch_size,
+                            std::size_t depth      = detail::default_prefetch_depth) {
+    using view_type  = any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>;
+    using value_type = std::ranges::range_value_t<view_type>;
+
+    return any_view<value_type, any_view_options::input, value_type&, value_type&&, DiffT>{
+        detail::prefetch_view<view_type>{std::move(view), batch_size, depth}};
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_PREFETCH_HPP
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_PUSHDOWN_HPP
+#define BEMAN_ANY_VIEW_PUSHDOWN_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace beman::any_view {
+
+// each function below applies its adaptor to the view erased by view rather than erasing the adapted view again, so
+// its result has the same type, a single layer of type erasure, and the iterator category and sizedness of view
+
+// returns a view of the first count elements of view, which owns the view erased by view
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+[[nodiscard]] constexpr any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>
+take(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT> view, std::type_identity_t<DiffT> count) {
+    return detail::any_view_access::take(std::move(view), count);
+}
+
+// returns a view of the elements of view after the first count, which owns the view erased by view
+// like std::views::drop, the skipped elements are traversed whenever iteration begins unless view is random access
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+[[nodiscard]] constexpr any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>
+drop(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT> view, std::type_identity_t<DiffT> count) {
+    return detail::any_view_access::drop(std::move(view), count);
+}
+
+// returns a view of the elements of view from the last to the first, which owns the view erased by view
+// reversing a view which has been taken or dropped from traverses it once unless it is sized
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+    requires(detail::flag_is_set<OptsV, any_view_options::bidirectional> and
+             not detail::flag_is_set<OptsV, any_view_options::contiguous>)
+[[nodiscard]] constexpr any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>
+reverse(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT> view) {
+    return detail::any_view_access::reverse(std::move(view));
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_PUSHDOWN_HPP
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_SEGMENTS_HPP
+#define BEMAN_ANY_VIEW_SEGMENTS_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace beman::any_view {
+
+// input view of an any_view as spans of adjacent elements, each of which is fetched with a single dispatch
+// contiguous ranges yield a single span, while segmented ranges such as std::deque yield one span per segment
+template <class AnyViewT>
+    requires std::is_lvalue_reference_v<std::ranges::range_reference_t<AnyViewT>>
+class segment_view : public std::ranges::view_interface<segment_view<AnyViewT>> {
+    using reference        = std::ranges::range_reference_t<AnyViewT>;
+    using protocol_type    = detail::next_segment_t<reference>;
+    using polymorphic_type = decltype(detail::any_view_access::begin_polymorphic(std::declval<AnyViewT&>()));
+
+  public:
+    using segment = typename protocol_type::segment_type;
+
+  private:
+    AnyViewT                        base;
+    std::optional<polymorphic_type> poly;
+    segment                         current;
+
+    constexpr void fetch(bool advance) { current = detail::dispatch<protocol_type, polymorphic_type>(*poly, advance); }
+
+  public:
+    class iterator {
+        segment_view* parent;
+
+      public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type       = segment;
+        using difference_type  = std::ptrdiff_t;
+
+        constexpr explicit iterator(segment_view* parent) noexcept : parent(parent) {}
+
+        constexpr iterator(iterator&&) noexcept = default;
+
+        constexpr iterator& operator=(iterator&&) noexcept = default;
+
+        [[nodiscard]] constexpr segment operator*() const noexcept { return parent->current; }
+
+        constexpr iterator& operator++() {
+            parent->fetch(true);
+            return *this;
+        }
+
+        constexpr void operator++(int) { ++*this; }
+
+        [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept {
+            return parent->current.empty();
+        }
+    };
+
+    constexpr explicit segment_view(AnyViewT base) noexcept : base(std::move(base)) {}
+
+    [[nodiscard]] constexpr iterator begin() {
+        poly.emplace(detail::any_view_access::begin_polymorphic(base));
+        fetch(false);
+        return iterator{this};
+    }
+
+    [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+    requires std::is_lvalue_reference_v<RefT>
+[[nodiscard]] constexpr segment_view<any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>>
+segments(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT> view) noexcept {
+    return segment_view<any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>>{std::move(view)};
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_SEGMENTS_HPP
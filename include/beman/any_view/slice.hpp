@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_SLICE_HPP
+#define BEMAN_ANY_VIEW_SLICE_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <type_traits>
+
+namespace beman::any_view {
+
+// returns a view of the elements of view in [first, last), with the same type and a single layer of type erasure
+// the slice refers to the elements of view, so it must not outlive view if view owns them
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+    requires(detail::flag_is_set<OptsV, any_view_options::random_access | any_view_options::sized>)
+[[nodiscard]] constexpr any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>
+slice(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view,
+      std::type_identity_t<DiffT>                         first,
+      std::type_identity_t<DiffT>                         last) {
+    return detail::any_view_access::slice(view, first, last);
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_SLICE_HPP
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_SPILL_HPP
+#define BEMAN_ANY_VIEW_SPILL_HPP
+
+#include <beman/any_view/any_view.hpp>
+#include <beman/any_view/detail/spill.hpp>
+
+#include <concepts>
+#include <utility>
+
+namespace beman::any_view {
+namespace detail {
+
+template <class AnyViewT, class RangeT>
+using erased_adaptor_t = decltype(any_view_access::make_adaptor<AnyViewT>(std::declval<RangeT>()));
+
+} // namespace detail
+
+// a view or iterator spills when its adaptor does not fit inplace, so that it is allocated
+// spill_info::type_name is the implementation-defined name of its adaptor type, as returned by std::type_info::name
+using detail::get_spill_handler;
+using detail::set_spill_handler;
+using detail::spill_handler;
+using detail::spill_info;
+using detail::spill_kind;
+
+// whether AnyViewT allocates when it erases RangeT
+template <class AnyViewT, class RangeT>
+    requires std::constructible_from<AnyViewT, RangeT>
+inline constexpr bool view_spills_v =
+    not detail::view_storage::fits_inplace<detail::erased_adaptor_t<AnyViewT, RangeT>>;
+
+// whether the iterators of AnyViewT allocate when it erases RangeT
+template <class AnyViewT, class RangeT>
+    requires std::constructible_from<AnyViewT, RangeT>
+inline constexpr bool iterator_spills_v =
+    not detail::iterator_storage::fits_inplace<detail::iterator_adaptor_t<detail::erased_adaptor_t<AnyViewT, RangeT>>>;
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_SPILL_HPP
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_TARGET_HPP
+#define BEMAN_ANY_VIEW_TARGET_HPP
+
+#include <beman/any_view/any_view.hpp>
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+
+namespace beman::any_view {
+namespace detail {
+
+template <class ViewT, class AnyViewT>
+[[nodiscard]] constexpr const ViewT* target_view(const AnyViewT& view) noexcept {
+    using polymorphic_type = std::remove_cvref_t<decltype(any_view_access::polymorphic(view))>;
+
+    // static_cast from void pointer is not constexpr until C++26
+    return static_cast<const ViewT*>(
+        dispatch<target_t, polymorphic_type>(any_view_access::polymorphic(view), typeid(ViewT)));
+}
+
+} // namespace detail
+
+// returns a pointer to the type erased view if its type is T, or a null pointer otherwise
+// if T is a range but not a view, also finds T wrapped in std::ranges::ref_view or std::ranges::owning_view
+template <class T, class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+[[nodiscard]] constexpr const T* target(const any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view) noexcept {
+    if constexpr (std::ranges::view<T>) {
+        return detail::target_view<T>(view);
+    } else {
+        if constexpr (requires { typename std::ranges::ref_view<T>; }) {
+            if (const auto ref = detail::target_view<std::ranges::ref_view<T>>(view)) {
+                return std::addressof(ref->base());
+            }
+        }
+
+        if constexpr (requires { typename std::ranges::owning_view<T>; }) {
+            if (const auto owning = detail::target_view<std::ranges::owning_view<T>>(view)) {
+                return std::addressof(owning->base());
+            }
+        }
+
+        return nullptr;
+    }
+}
+
+template <class T, class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+[[nodiscard]] constexpr T* target(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view) noexcept {
+    return const_cast<T*>(beman::any_view::target<T>(std::as_const(view)));
+}
+
+namespace detail {
+
+template <class ResultT, class AnyViewT, class FunctionT>
+constexpr ResultT visit_first(AnyViewT& view, FunctionT& function) {
+    return std::invoke(function, view);
+}
+
+template <class ResultT, class AnyViewT, class FunctionT, class T, class... Ts>
+constexpr ResultT
+visit_first(AnyViewT& view, FunctionT& function, std::type_identity<T>, std::type_identity<Ts>... rest) {
+    if (const auto target_ptr = beman::any_view::target<T>(view)) {
+        return std::invoke(function, *target_ptr);
+    }
+
+    return detail::visit_first<ResultT>(view, function, rest...);
+}
+
+} // namespace detail
+
+// invokes function with the type erased view as the first of Ts that it is, or with view itself otherwise
+// lets function inline its traversal of the types that are known to be common
+template <class... Ts,
+          class ElementT,
+          any_view_options OptsV,
+          class RefT,
+          class RValueRefT,
+          class DiffT,
+          class FunctionT>
+    requires std::invocable<FunctionT&, any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>&> and
+             (... and std::is_invocable_r_v<
+                          std::invoke_result_t<FunctionT&, any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>&>,
+                          FunctionT&,
+                          Ts&>)
+constexpr decltype(auto) visit_as(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view, FunctionT&& function) {
+    using result_type = std::invoke_result_t<FunctionT&, any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>&>;
+    return detail::visit_first<result_type>(view, function, std::type_identity<Ts>{}...);
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_TARGET_HPP
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef BEMAN_ANY_VIEW_TO_HPP
+#define BEMAN_ANY_VIEW_TO_HPP
+
+#include <beman/any_view/any_view.hpp>
+#include <beman/any_view/detail/unreachable.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace beman::any_view {
+namespace detail {
+
+template <class ContainerT, class RefT>
+concept appendable_container =
+    requires(ContainerT& container, RefT&& ref) { container.emplace_back(std::forward<RefT>(ref)); } or
+    requires(ContainerT& container, RefT&& ref) { container.push_back(std::forward<RefT>(ref)); } or
+    requires(ContainerT& container, RefT&& ref) { container.insert(container.end(), std::forward<RefT>(ref)); };
+
+template <class ContainerT, class RefT>
+constexpr void append_element(ContainerT& container, RefT&& ref) {
+    if constexpr (requires { container.emplace_back(std::forward<RefT>(ref)); }) {
+        container.emplace_back(std::forward<RefT>(ref));
+    } else if constexpr (requires { container.push_back(std::forward<RefT>(ref)); }) {
+        container.push_back(std::forward<RefT>(ref));
+    } else {
+        container.insert(container.end(), std::forward<RefT>(ref));
+    }
+}
+
+// grows capacity geometrically, so that appending to a non-empty container repeatedly does not reallocate each time
+template <class ContainerT>
+struct reserve_sink : callable_base {
+    ContainerT& container;
+
+    constexpr explicit reserve_sink(ContainerT& container) noexcept : container(container) {}
+
+    constexpr void operator()(std::size_t count) const {
+        if constexpr (requires { container.reserve(container.size()); }) {
+            const auto size = static_cast<std::size_t>(container.size());
+
+            if (size + count > static_cast<std::size_t>(container.capacity())) {
+                container.reserve(std::max(size + count, 2 * size));
+            }
+        }
+    }
+};
+
+// a contiguous range of trivially copyable elements is inserted with a single memmove by std::vector
+// segments are only appended if elements are copied or trivially copyable, so other elements never reach this sink
+template <class ContainerT>
+struct segment_sink : callable_base {
+    ContainerT& container;
+
+    constexpr explicit segment_sink(ContainerT& container) noexcept : container(container) {}
+
+    template <class SegmentT>
+    constexpr void operator()(SegmentT segment) const {
+        using reference = std::ranges::range_reference_t<SegmentT>;
+
+        if constexpr (not appendable_container<ContainerT, reference> or
+                      not std::constructible_from<std::ranges::range_value_t<ContainerT>, reference>) {
+            unreachable();
+        } else if constexpr (requires { container.insert(container.end(), segment.begin(), segment.end()); }) {
+            container.insert(container.end(), segment.begin(), segment.end());
+        } else {
+            for (const auto& element : segment) {
+                detail::append_element(container, element);
+            }
+        }
+    }
+};
+
+template <class ContainerT, class RefT>
+struct element_sink : callable_base {
+    ContainerT& container;
+
+    constexpr explicit element_sink(ContainerT& container) noexcept : container(container) {}
+
+    constexpr void operator()(RefT ref) const { detail::append_element(container, std::forward<RefT>(ref)); }
+};
+
+template <bool MoveV, class RefT, class ContainerT, class AnyViewT>
+constexpr void append_to(AnyViewT& view, ContainerT& container) {
+    using polymorphic_type = std::remove_cvref_t<decltype(any_view_access::polymorphic(view))>;
+
+    reserve_sink<ContainerT>       reserve{container};
+    segment_sink<ContainerT>       append_segment{container};
+    element_sink<ContainerT, RefT> append{container};
+
+    dispatch<append_to_t<RefT, MoveV>, polymorphic_type>(
+        any_view_access::polymorphic(view), reserve, append_segment, append);
+}
+
+} // namespace detail
+
+// appends each element of view to the end of container with a single dispatch
+// reserves capacity ahead if the type erased view is approximately sized, and appends a contiguous view as one range
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT, class ContainerT>
+    requires detail::appendable_container<ContainerT, RefT>
+constexpr void copy_to(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view, ContainerT& container) {
+    detail::append_to<false, RefT>(view, container);
+}
+
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT, class ContainerT>
+    requires detail::appendable_container<ContainerT, RefT>
+constexpr void copy_to(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>&& view, ContainerT& container) {
+    beman::any_view::copy_to(view, container);
+}
+
+// like copy_to, but moves each element out of view
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT, class ContainerT>
+    requires detail::appendable_container<ContainerT, RValueRefT>
+constexpr void move_to(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view, ContainerT& container) {
+    detail::append_to<true, RValueRefT>(view, container);
+}
+
+template <class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT, class ContainerT>
+    requires detail::appendable_container<ContainerT, RValueRefT>
+constexpr void move_to(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>&& view, ContainerT& container) {
+    beman::any_view::move_to(view, container);
+}
+
+// returns a container of the elements of view, copied with a single dispatch
+template <class ContainerT, class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+    requires std::default_initializable<ContainerT> and detail::appendable_container<ContainerT, RefT>
+[[nodiscard]] constexpr ContainerT to(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>& view) {
+    ContainerT container;
+    beman::any_view::copy_to(view, container);
+    return container;
+}
+
+template <class ContainerT, class ElementT, any_view_options OptsV, class RefT, class RValueRefT, class DiffT>
+    requires std::default_initializable<ContainerT> and detail::appendable_container<ContainerT, RefT>
+[[nodiscard]] constexpr ContainerT to(any_view<ElementT, OptsV, RefT, RValueRefT, DiffT>&& view) {
+    return beman::any_view::to<ContainerT>(view);
+}
+
+} // namespace beman::any_view
+
+#endif // BEMAN_ANY_VIEW_TO_HPP
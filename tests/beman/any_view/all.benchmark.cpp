@@ -6,6 +6,9 @@
 #include "detail/products.hpp"
 #include "detail/reserved.hpp"
 
+#include <beman/any_view/for_each.hpp>
+#include <beman/any_view/to.hpp>
+
 #include <benchmark/benchmark.h>
 
 constexpr auto max_size = 1 << 18;
@@ -58,6 +61,17 @@ static void BM_all_lazy(benchmark::State& state) {
     }
 }
 
+static void BM_all_for_each(benchmark::State& state) {
+    const auto size  = state.range(0);
+    const auto begin = global_products.begin();
+
+    lazy::database db{.products = {begin, begin + size}};
+
+    for (auto _ : state) {
+        beman::any_view::for_each(db.get_products({.min_quantity = 10}), [](std::string_view name) { use(name); });
+    }
+}
+
 static void BM_all_reserved(benchmark::State& state) {
     const auto size  = state.range(0);
     const auto begin = global_products.begin();
@@ -71,9 +85,24 @@ static void BM_all_reserved(benchmark::State& state) {
     }
 }
 
+static void BM_all_to(benchmark::State& state) {
+    const auto size  = state.range(0);
+    const auto begin = global_products.begin();
+
+    lazy::database db{.products = {begin, begin + size}};
+
+    for (auto _ : state) {
+        for (std::string_view name : beman::any_view::to<eager::names_t>(db.get_products({.min_quantity = 10}))) {
+            use(name);
+        }
+    }
+}
+
 BENCHMARK(BM_all_eager)->RangeMultiplier(2)->Range(1 << 10, max_size);
 BENCHMARK(BM_all_fused)->RangeMultiplier(2)->Range(1 << 10, max_size);
 BENCHMARK(BM_all_lazy)->RangeMultiplier(2)->Range(1 << 10, max_size);
+BENCHMARK(BM_all_for_each)->RangeMultiplier(2)->Range(1 << 10, max_size);
 BENCHMARK(BM_all_reserved)->RangeMultiplier(2)->Range(1 << 10, max_size);
+BENCHMARK(BM_all_to)->RangeMultiplier(2)->Range(1 << 10, max_size);
 
 BENCHMARK_MAIN();
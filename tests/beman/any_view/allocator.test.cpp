@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/any_view.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+using beman::any_view::any_view;
+using enum beman::any_view::any_view_options;
+
+struct allocation_counter {
+    int allocations   = 0;
+    int deallocations = 0;
+};
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    allocation_counter* counter;
+
+    constexpr explicit counting_allocator(allocation_counter* counter) noexcept : counter(counter) {}
+
+    template <class U>
+    constexpr counting_allocator(const counting_allocator<U>& other) noexcept : counter(other.counter) {}
+
+    constexpr T* allocate(std::size_t n) {
+        ++counter->allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    constexpr void deallocate(T* ptr, std::size_t n) noexcept {
+        ++counter->deallocations;
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template <class U>
+    constexpr bool operator==(const counting_allocator<U>& other) const noexcept {
+        return counter == other.counter;
+    }
+};
+
+// too large to be stored inplace, as is its iterator
+constexpr auto padded(const std::vector<int>& vec) {
+    return std::views::transform(vec, [padding = std::array<int, 8>{}](int n) { return n + padding[0]; });
+}
+
+constexpr auto sum(auto&& view) {
+    auto result = 0;
+
+    for (const int value : view) {
+        result += value;
+    }
+
+    return result;
+}
+
+TEST(AllocatorTest, spilled) {
+    std::vector<int>   vec{1, 2, 3, 4, 5};
+    allocation_counter counter;
+
+    {
+        any_view<int, forward, int> view{std::allocator_arg, counting_allocator<std::byte>{&counter}, padded(vec)};
+        EXPECT_EQ(counter.allocations, 1);
+
+        EXPECT_EQ(sum(view), 15);
+        EXPECT_EQ(counter.allocations, 2);
+    }
+
+    EXPECT_EQ(counter.deallocations, counter.allocations);
+}
+
+TEST(AllocatorTest, inplace) {
+    std::vector<int>   vec{1, 2, 3, 4, 5};
+    allocation_counter counter;
+
+    any_view<int, forward> view{std::allocator_arg, counting_allocator<std::byte>{&counter}, vec};
+
+    EXPECT_EQ(sum(view), 15);
+    EXPECT_EQ(counter.allocations, 0);
+}
+
+TEST(AllocatorTest, copy) {
+    std::vector<int>   vec{1, 2, 3, 4, 5};
+    allocation_counter counter;
+
+    {
+        any_view<int, forward | copyable, int> view{
+            std::allocator_arg, counting_allocator<std::byte>{&counter}, padded(vec)};
+        auto copy = view;
+
+        EXPECT_EQ(counter.allocations, 2);
+        EXPECT_EQ(sum(copy), 15);
+    }
+
+    EXPECT_EQ(counter.deallocations, counter.allocations);
+}
+
+TEST(AllocatorTest, sum_vector) {
+    constexpr auto sum_vector = [] {
+        std::vector<int> vec{1, 2, 3, 4, 5};
+        return sum(any_view<int, forward, int>{std::allocator_arg, std::allocator<std::byte>{}, padded(vec)});
+    };
+
+#ifndef _MSC_VER
+    // error C2131: expression did not evaluate to a constant
+    static_assert(15 == sum_vector());
+#endif
+    EXPECT_EQ(15, sum_vector());
+}
+
+TEST(AllocatorTest, memory_resource) {
+    std::vector<std::vector<int>>       vecs{{1, 2}, {3}, {4, 5}};
+    std::array<std::byte, 1024>         buffer;
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    // std::views::join iterators do not fit inplace, so the arena must be used
+    any_view<int, bidirectional> view{
+        std::allocator_arg, std::pmr::polymorphic_allocator<>{&arena}, vecs | std::views::join};
+
+    EXPECT_EQ(sum(view), 15);
+    EXPECT_EQ(sum(view), 15);
+}
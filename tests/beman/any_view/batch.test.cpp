@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/batch.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::batches;
+using enum beman::any_view::any_view_options;
+
+template <std::size_t SizeV, class AnyViewT>
+constexpr auto batch_sizes(AnyViewT view) {
+    std::vector<std::size_t> sizes;
+
+    for (auto batch : batches<SizeV>(std::move(view))) {
+        sizes.push_back(std::ranges::size(batch));
+    }
+
+    return sizes;
+}
+
+TEST(BatchTest, sizes) {
+    EXPECT_EQ(batch_sizes<4>(any_view<int, forward>{std::vector<int>(10)}), (std::vector<std::size_t>{4, 4, 2}));
+    EXPECT_EQ(batch_sizes<5>(any_view<int, forward>{std::vector<int>(10)}), (std::vector<std::size_t>{5, 5}));
+    EXPECT_TRUE(batch_sizes<4>(any_view<int, forward>{}).empty());
+}
+
+constexpr auto sum(any_view<const int> view) {
+    auto result = 0;
+
+    for (auto batch : batches<3>(std::move(view))) {
+        for (const int value : batch) {
+            result += value;
+        }
+    }
+
+    return result;
+}
+
+TEST(BatchTest, sum_vector) {
+#ifndef _MSC_VER
+    // error C2131: expression did not evaluate to a constant
+    static_assert(15 == sum(std::vector{1, 2, 3, 4, 5}));
+#endif
+    EXPECT_EQ(15, sum(std::vector{1, 2, 3, 4, 5}));
+}
+
+TEST(BatchTest, lvalue_reference) {
+    std::vector<int> vec{1, 2, 3, 4, 5};
+
+    for (auto batch : batches<2>(any_view<int, forward>{vec})) {
+        for (int& value : batch) {
+            value *= 2;
+        }
+    }
+
+    EXPECT_EQ(vec, (std::vector{2, 4, 6, 8, 10}));
+}
+
+TEST(BatchTest, prvalue_reference) {
+    auto transformed = std::views::iota(0, 5) | std::views::transform([](int n) { return std::to_string(n); });
+    auto result      = std::string{};
+
+    for (auto batch : batches<2>(any_view<std::string, forward, std::string>{transformed})) {
+        for (const std::string& value : batch) {
+            result += value;
+        }
+    }
+
+    EXPECT_EQ(result, "01234");
+}
+
+TEST(BatchTest, input_reference) {
+    // references into std::views::istream are invalidated by increment, so each batch holds a single element
+    std::istringstream in{"1 2 3 4"};
+
+    EXPECT_EQ(batch_sizes<4>(any_view<const int>{std::views::istream<int>(in)}),
+              (std::vector<std::size_t>{1, 1, 1, 1}));
+
+    std::istringstream again{"1 2 3 4"};
+
+    EXPECT_EQ(10, sum(std::views::istream<int>(again)));
+}
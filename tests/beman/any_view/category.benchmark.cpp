@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/any_view.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+using beman::any_view::any_view;
+using enum beman::any_view::any_view_options;
+
+constexpr auto max_size = 1 << 18;
+
+const auto global_values = [] {
+    std::vector<int> values(max_size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}();
+
+// lvalue references into a contiguous range, which iterators of each category can cache a pointer to
+struct lvalue_source {
+    static auto make(std::int64_t size) {
+        const auto begin = global_values.begin();
+        return std::ranges::subrange(begin, begin + size);
+    }
+};
+
+// prvalues of a random access range, which iterators cannot cache a pointer to
+struct prvalue_source {
+    static auto make(std::int64_t size) {
+        return lvalue_source::make(size) | std::views::transform([](int value) { return value; });
+    }
+};
+
+// reports the time per element next to the time per iteration
+static void set_per_element(benchmark::State& state) {
+    state.counters["per_element"] = benchmark::Counter(static_cast<double>(state.range(0)),
+                                                       benchmark::Counter::kIsIterationInvariantRate |
+                                                           benchmark::Counter::kInvert);
+}
+
+template <class SourceT>
+static void BM_category_native(benchmark::State& state) {
+    // prevent the compiler from seeing through the range
+    auto values = SourceT::make(state.range(0));
+    benchmark::DoNotOptimize(values);
+
+    for (auto _ : state) {
+        auto sum = 0;
+
+        for (const int value : values) {
+            sum += value;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    set_per_element(state);
+}
+
+template <class SourceT, class AnyViewT>
+static void BM_category_erased(benchmark::State& state) {
+    // prevent the compiler from seeing through the type erasure
+    auto values = SourceT::make(state.range(0));
+    benchmark::DoNotOptimize(values);
+
+    for (auto _ : state) {
+        AnyViewT view{values};
+        auto     sum = 0;
+
+        for (const int value : view) {
+            sum += value;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    set_per_element(state);
+}
+
+// subscripts the view instead of traversing it, which constructs an iterator for each element
+template <class SourceT, class AnyViewT>
+static void BM_category_indexed(benchmark::State& state) {
+    auto values = SourceT::make(state.range(0));
+    benchmark::DoNotOptimize(values);
+
+    for (auto _ : state) {
+        AnyViewT   view{values};
+        const auto size = std::ranges::ssize(view);
+        auto       sum  = 0;
+
+        for (auto index = 0; index != size; ++index) {
+            sum += view[index];
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    set_per_element(state);
+}
+
+static void sizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(8)->Range(1 << 9, max_size);
+}
+
+BENCHMARK(BM_category_native<lvalue_source>)->Apply(sizes);
+BENCHMARK(BM_category_erased<lvalue_source, any_view<const int>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<lvalue_source, any_view<const int, forward>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<lvalue_source, any_view<const int, bidirectional>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<lvalue_source, any_view<const int, random_access>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<lvalue_source, any_view<const int, random_access | sized>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<lvalue_source, any_view<const int, contiguous>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<lvalue_source, any_view<const int, contiguous | sized>>)->Apply(sizes);
+BENCHMARK(BM_category_indexed<lvalue_source, any_view<const int, random_access | sized>>)->Apply(sizes);
+BENCHMARK(BM_category_indexed<lvalue_source, any_view<const int, contiguous | sized>>)->Apply(sizes);
+
+BENCHMARK(BM_category_native<prvalue_source>)->Apply(sizes);
+BENCHMARK(BM_category_erased<prvalue_source, any_view<int, input, int>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<prvalue_source, any_view<int, forward, int>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<prvalue_source, any_view<int, bidirectional, int>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<prvalue_source, any_view<int, random_access, int>>)->Apply(sizes);
+BENCHMARK(BM_category_erased<prvalue_source, any_view<int, random_access | sized, int>>)->Apply(sizes);
+BENCHMARK(BM_category_indexed<prvalue_source, any_view<int, random_access | sized, int>>)->Apply(sizes);
+
+BENCHMARK_MAIN();
@@ -156,3 +156,22 @@ TEST(ConstexprTest, copy_convert) {
 #endif
     EXPECT_EQ(make_copy_convert().front(), 1);
 }
+
+TEST(ConstexprTest, convert) {
+    constexpr auto sum_converted = [] {
+        any_view<long, forward, long> view = any_view<int, forward, int>{std::views::iota(0, 40)};
+        auto                          result = 0l;
+
+        for (const long value : view) {
+            result += value;
+        }
+
+        return result;
+    };
+
+#ifndef _MSC_VER
+    // error C2131: expression did not evaluate to a constant
+    static_assert(sum_converted() == 780);
+#endif
+    EXPECT_EQ(sum_converted(), 780);
+}
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/any_view.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::any_view_options;
+using enum beman::any_view::any_view_options;
+
+constexpr auto size = 1 << 16;
+
+const auto global_values = [] {
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}();
+
+// erases view DepthV times, alternating between any_views of int and long so that each one wraps the previous one
+template <any_view_options OptsV, std::size_t DepthV, class ViewT>
+auto erase(ViewT view) {
+    if constexpr (DepthV == 0) {
+        return view;
+    } else if constexpr (DepthV % 2 == 0) {
+        return erase<OptsV, DepthV - 1>(any_view<long, OptsV, long>{std::move(view)});
+    } else {
+        return erase<OptsV, DepthV - 1>(any_view<int, OptsV, int>{std::move(view)});
+    }
+}
+
+template <any_view_options OptsV, std::size_t DepthV>
+static void BM_depth(benchmark::State& state) {
+    // prevent the compiler from seeing through the type erasure
+    auto values = std::ranges::subrange(global_values.begin(), global_values.end());
+    benchmark::DoNotOptimize(values);
+
+    for (auto _ : state) {
+        auto view = erase<OptsV, DepthV>(values | std::views::transform([](int value) { return value; }));
+        auto sum  = 0l;
+
+        for (const long value : view) {
+            sum += value;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * size);
+}
+
+BENCHMARK(BM_depth<input, 0>);
+BENCHMARK(BM_depth<input, 1>);
+BENCHMARK(BM_depth<input, 2>);
+BENCHMARK(BM_depth<input, 3>);
+BENCHMARK(BM_depth<input, 4>);
+BENCHMARK(BM_depth<forward, 1>);
+BENCHMARK(BM_depth<forward, 2>);
+BENCHMARK(BM_depth<forward, 3>);
+BENCHMARK(BM_depth<forward, 4>);
+BENCHMARK(BM_depth<bidirectional, 1>);
+BENCHMARK(BM_depth<bidirectional, 2>);
+BENCHMARK(BM_depth<bidirectional, 3>);
+BENCHMARK(BM_depth<bidirectional, 4>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/any_view.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <vector>
+
+using beman::any_view::any_view;
+using enum beman::any_view::any_view_options;
+
+constexpr auto max_size = 1 << 18;
+
+const auto global_values = [] {
+    std::vector<int> values(max_size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}();
+
+template <class AnyViewT>
+static void BM_dispatch(benchmark::State& state) {
+    const auto size  = state.range(0);
+    const auto begin = global_values.begin();
+
+    // prevent the compiler from seeing through the type erasure
+    auto values = std::ranges::subrange(begin, begin + size);
+    benchmark::DoNotOptimize(values);
+
+    for (auto _ : state) {
+        AnyViewT view{values};
+        auto     sum = 0;
+
+        for (const int value : view) {
+            sum += value;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(BM_dispatch<any_view<const int>>)->RangeMultiplier(4)->Range(1 << 10, max_size);
+BENCHMARK(BM_dispatch<any_view<const int, input | inline_dispatch>>)->RangeMultiplier(4)->Range(1 << 10, max_size);
+BENCHMARK(BM_dispatch<any_view<const int, forward>>)->RangeMultiplier(4)->Range(1 << 10, max_size);
+BENCHMARK(BM_dispatch<any_view<const int, forward | inline_dispatch>>)->RangeMultiplier(4)->Range(1 << 10, max_size);
+BENCHMARK(BM_dispatch<any_view<int, input, int>>)->RangeMultiplier(4)->Range(1 << 10, max_size);
+BENCHMARK(BM_dispatch<any_view<int, input | inline_dispatch, int>>)->RangeMultiplier(4)->Range(1 << 10, max_size);
+
+BENCHMARK_MAIN();
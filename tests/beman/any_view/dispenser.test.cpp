@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/dispenser.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::chunk_dispenser;
+using enum beman::any_view::any_view_options;
+
+TEST(DispenserTest, chunks) {
+    std::istringstream in{"1 2 3 4 5 6 7"};
+    chunk_dispenser    dispenser{any_view<int>{std::views::istream<int>(in)}, 3};
+    std::vector<int>   buffer;
+
+    ASSERT_TRUE(dispenser.next(buffer));
+    EXPECT_EQ(buffer, (std::vector{1, 2, 3}));
+    ASSERT_TRUE(dispenser.next(buffer));
+    EXPECT_EQ(buffer, (std::vector{4, 5, 6}));
+    ASSERT_TRUE(dispenser.next(buffer));
+    EXPECT_EQ(buffer, (std::vector{7}));
+    EXPECT_FALSE(dispenser.next(buffer));
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(dispenser.next(buffer));
+}
+
+TEST(DispenserTest, default_construct) {
+    chunk_dispenser  dispenser{any_view<int>{}, 3};
+    std::vector<int> buffer{1};
+
+    EXPECT_FALSE(dispenser.next(buffer));
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(DispenserTest, move_only) {
+    std::vector<std::unique_ptr<int>> vec;
+    vec.push_back(std::make_unique<int>(1));
+    vec.push_back(std::make_unique<int>(2));
+
+    chunk_dispenser                   dispenser{any_view<std::unique_ptr<int>>{vec}, 4};
+    std::vector<std::unique_ptr<int>> buffer;
+
+    ASSERT_TRUE(dispenser.next(buffer));
+    ASSERT_EQ(buffer.size(), 2);
+    EXPECT_EQ(*buffer[1], 2);
+    EXPECT_EQ(vec[1], nullptr);
+}
+
+TEST(DispenserTest, threads) {
+    constexpr int count = 10000;
+
+    std::string text;
+    for (int value = 0; value != count; ++value) {
+        text += std::to_string(value) + ' ';
+    }
+
+    std::istringstream in{text};
+    chunk_dispenser    dispenser{any_view<const int>{std::views::istream<int>(in)}, 64};
+    std::vector<int>   seen(count);
+
+    {
+        std::vector<std::jthread> threads;
+
+        for (int thread = 0; thread != 4; ++thread) {
+            threads.emplace_back([&] {
+                std::vector<int> buffer;
+
+                while (dispenser.next(buffer)) {
+                    for (const int value : buffer) {
+                        ++seen[value];
+                    }
+                }
+            });
+        }
+    }
+
+    EXPECT_TRUE(std::ranges::all_of(seen, [](int times) { return times == 1; }));
+}
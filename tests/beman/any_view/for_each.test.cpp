@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/for_each.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::for_each;
+using enum beman::any_view::any_view_options;
+
+constexpr auto sum(any_view<const int> view) {
+    auto result = 0;
+
+    for_each(view, [&](int value) { result += value; });
+
+    return result;
+}
+
+TEST(ForEachTest, sum_vector) {
+#ifndef _MSC_VER
+    // error C2131: expression did not evaluate to a constant
+    static_assert(15 == sum(std::vector{1, 2, 3, 4, 5}));
+#endif
+    EXPECT_EQ(15, sum(std::vector{1, 2, 3, 4, 5}));
+}
+
+TEST(ForEachTest, default_construct) {
+    any_view<const int> view;
+
+    EXPECT_TRUE(for_each(view, [](int) { return false; }));
+}
+
+TEST(ForEachTest, early_termination) {
+    std::vector<int> visited;
+
+    const auto completed = for_each(any_view<int, forward, int>{std::views::iota(0)}, [&](int value) {
+        visited.push_back(value);
+        return value < 3;
+    });
+
+    EXPECT_FALSE(completed);
+    EXPECT_EQ(visited, (std::vector{0, 1, 2, 3}));
+}
+
+TEST(ForEachTest, lvalue_reference) {
+    std::vector<int> vec{1, 2, 3};
+    any_view<int>    view{vec};
+
+    for_each(view, [](int& value) { value *= 2; });
+
+    EXPECT_EQ(vec, (std::vector{2, 4, 6}));
+}
+
+TEST(ForEachTest, filter_transform) {
+    auto pipeline = std::views::iota(0, 10) | std::views::filter([](int n) { return n % 2 == 0; }) |
+                    std::views::transform([](int n) { return std::to_string(n); });
+    auto result   = std::string{};
+
+    for_each(any_view<std::string, input, std::string>{pipeline}, [&](std::string value) { result += value; });
+
+    EXPECT_EQ(result, "02468");
+}
+
+TEST(ForEachTest, add_const) {
+    std::istringstream  in{"1 2 3 4"};
+    any_view<int>       view{std::views::istream<int>(in)};
+    any_view<const int> const_view{std::move(view)};
+    auto                result = 0;
+
+    for_each(const_view, [&](const int& value) { result += value; });
+
+    EXPECT_EQ(result, 10);
+}
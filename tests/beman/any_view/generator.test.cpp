@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/generator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::generator;
+
+namespace {
+
+generator<int> iota(int first, int last) {
+    for (int value = first; value != last; ++value) {
+        co_yield value;
+    }
+}
+
+generator<int> elements_of(std::vector<int>& elements) {
+    for (int& element : elements) {
+        co_yield element;
+    }
+}
+
+generator<const std::string> words() {
+    const std::string hello = "hello";
+    co_yield hello;
+    co_yield std::string{"world"};
+    co_yield "!";
+}
+
+generator<int*> local_address() {
+    int local = 0;
+    co_yield &local;
+}
+
+generator<int> throwing() {
+    co_yield 1;
+    throw std::runtime_error{"generator"};
+}
+
+template <class RangeT>
+auto to_vector(RangeT&& range) {
+    std::vector<std::ranges::range_value_t<RangeT>> result;
+
+    for (auto&& element : range) {
+        result.push_back(element);
+    }
+
+    return result;
+}
+
+} // namespace
+
+static_assert(std::ranges::input_range<generator<int>>);
+static_assert(std::ranges::view<generator<int>>);
+static_assert(not std::ranges::forward_range<generator<int>>);
+static_assert(std::same_as<std::ranges::range_reference_t<generator<int>>, int&>);
+static_assert(std::same_as<std::ranges::range_reference_t<generator<const int>>, const int&>);
+
+TEST(GeneratorTest, yields) {
+    EXPECT_EQ(to_vector(iota(0, 5)), (std::vector{0, 1, 2, 3, 4}));
+    EXPECT_EQ(to_vector(iota(0, 0)), std::vector<int>{});
+    EXPECT_EQ(to_vector(words()), (std::vector<std::string>{"hello", "world", "!"}));
+}
+
+TEST(GeneratorTest, reference) {
+    std::vector elements{1, 2, 3};
+
+    for (int& element : elements_of(elements)) {
+        element *= 10;
+    }
+
+    EXPECT_EQ(elements, (std::vector{10, 20, 30}));
+}
+
+TEST(GeneratorTest, erasure) {
+    any_view<int> view{iota(1, 4)};
+
+    EXPECT_EQ(to_vector(std::move(view)), (std::vector{1, 2, 3}));
+}
+
+TEST(GeneratorTest, exception) {
+    auto gen = throwing();
+    auto it  = gen.begin();
+
+    EXPECT_EQ(*it, 1);
+    EXPECT_THROW(++it, std::runtime_error);
+}
+
+TEST(GeneratorTest, frame_recycling) {
+    const auto first_address = [] {
+        auto gen = local_address();
+        return *gen.begin();
+    }();
+
+    const auto second_address = [] {
+        auto gen = local_address();
+        return *gen.begin();
+    }();
+
+    EXPECT_EQ(first_address, second_address);
+}
+
+TEST(GeneratorTest, frame_recycling_threads) {
+    std::vector<std::jthread> threads;
+
+    for (int index = 0; index != 4; ++index) {
+        threads.emplace_back([] {
+            for (int repetition = 0; repetition != 100; ++repetition) {
+                any_view<int> view{iota(0, 10)};
+                EXPECT_EQ(to_vector(std::move(view)).size(), 10);
+            }
+        });
+    }
+}
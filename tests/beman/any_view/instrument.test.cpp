@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/instrument.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::instrument;
+using beman::any_view::set_profile_handler;
+using beman::any_view::stage_operation;
+using beman::any_view::stage_profile;
+using enum beman::any_view::any_view_options;
+
+namespace {
+
+struct recorded_profile {
+    std::string   label;
+    stage_profile profile;
+};
+
+std::vector<recorded_profile> profiles;
+
+void record(const stage_profile& profile) { profiles.push_back({std::string{profile.label}, profile}); }
+
+// registers record for the scope of a test
+struct recording {
+    beman::any_view::profile_handler previous = set_profile_handler(record);
+
+    recording() { profiles.clear(); }
+
+    ~recording() { set_profile_handler(previous); }
+};
+
+} // namespace
+
+TEST(InstrumentTest, counts) {
+    const recording scope;
+
+    {
+        std::vector<int> vec{1, 2, 3};
+        auto             view = instrument(any_view<int>{vec}, "source");
+
+        EXPECT_TRUE(std::ranges::equal(view, vec));
+        EXPECT_TRUE(profiles.empty());
+    }
+
+    ASSERT_EQ(profiles.size(), 1);
+
+    const auto& [label, profile] = profiles[0];
+
+    EXPECT_EQ(label, "source");
+    EXPECT_EQ(profile.count(stage_operation::begin), 1);
+    EXPECT_EQ(profile.count(stage_operation::dereference), 3);
+    EXPECT_EQ(profile.count(stage_operation::next), 3);
+    EXPECT_EQ(profile.count(stage_operation::sentinel_compare), 4);
+    EXPECT_EQ(profile.count(stage_operation::prev), 0);
+    EXPECT_EQ(profile.begin_latency.total(), 1);
+    EXPECT_EQ(profile.element_latency.total(), 3);
+}
+
+TEST(InstrumentTest, random_access) {
+    const recording scope;
+
+    {
+        using view_type = any_view<int, random_access | sized | copyable>;
+
+        std::vector<int> vec{1, 2, 3, 4};
+        auto             view = instrument(view_type{vec}, "source");
+        auto             copy = view;
+
+        static_assert(std::ranges::random_access_range<view_type>);
+        EXPECT_EQ(copy.size(), 4);
+
+        auto it = copy.begin();
+        it += 2;
+
+        EXPECT_EQ(it[1], 4);
+        EXPECT_EQ(*(it - 1), 2);
+    }
+
+    ASSERT_EQ(profiles.size(), 1);
+
+    const auto& profile = profiles[0].profile;
+
+    EXPECT_EQ(profile.count(stage_operation::copy), 1);
+    EXPECT_EQ(profile.count(stage_operation::size), 1);
+    EXPECT_EQ(profile.count(stage_operation::advance), 3);
+    EXPECT_EQ(profile.count(stage_operation::next), 0);
+}
+
+TEST(InstrumentTest, pipeline) {
+    const recording scope;
+
+    {
+        std::vector<int> vec{1, 2, 3, 4, 5, 6};
+
+        auto source = instrument(any_view<int>{vec}, "source");
+        auto evens  = instrument(
+            any_view<int>{std::move(source) | std::views::filter([](int n) { return n % 2 == 0; })},
+            "evens");
+
+        std::vector<int> result;
+
+        for (int value : evens) {
+            result.push_back(value);
+        }
+
+        EXPECT_EQ(result, (std::vector{2, 4, 6}));
+    }
+
+    ASSERT_EQ(profiles.size(), 2);
+
+    // the outer stage owns the inner one, which is destroyed after it
+    EXPECT_EQ(profiles[0].label, "evens");
+    EXPECT_EQ(profiles[0].profile.count(stage_operation::next), 3);
+    EXPECT_EQ(profiles[1].label, "source");
+    EXPECT_EQ(profiles[1].profile.count(stage_operation::next), 6);
+    EXPECT_EQ(profiles[1].profile.count(stage_operation::dereference), 6);
+}
+
+TEST(InstrumentTest, unregistered) {
+    std::vector<int> vec{1, 2, 3};
+
+    {
+        const recording scope;
+    }
+
+    {
+        auto view = instrument(any_view<int>{vec}, "source");
+
+        EXPECT_TRUE(std::ranges::equal(view, vec));
+    }
+
+    EXPECT_TRUE(profiles.empty());
+}
@@ -6,7 +6,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <span>
+#include <sstream>
 #include <string>
+#include <vector>
 
 using beman::any_view::any_view;
 using enum beman::any_view::any_view_options;
@@ -65,3 +69,169 @@ TEST(IteratorTest, random_access_optimization) {
     EXPECT_EQ(*it, "val_3");
     EXPECT_EQ(offset, 3);
 }
+
+TEST(IteratorTest, inline_dispatch) {
+    auto transformed = std::views::iota(0) | std::views::transform([](int n) { return "val_" + std::to_string(n); });
+    auto view        = any_view<std::string, random_access | inline_dispatch, std::string>{transformed};
+
+    auto it1 = view.begin();
+    auto it2 = it1 + 5;
+
+    EXPECT_EQ(*it1, "val_0");
+    EXPECT_EQ(*it2, "val_5");
+    EXPECT_EQ(it2 - it1, 5);
+
+    // converts to and from views whose iterators dispatch through a pointer
+    any_view<std::string, forward, std::string>                 forward_view{std::move(view)};
+    any_view<std::string, input | inline_dispatch, std::string> input_view{std::move(forward_view)};
+
+    EXPECT_EQ(*input_view.begin(), "val_0");
+}
+
+// counts comparisons against its end, and is a sized sentinel only if SizedV
+template <bool SizedV>
+struct counting_sentinel {
+    const int*      end;
+    std::ptrdiff_t* comparisons;
+
+    friend bool operator==(const int* iterator, const counting_sentinel& sentinel) {
+        ++*sentinel.comparisons;
+        return SizedV ? iterator == sentinel.end : *iterator == 0;
+    }
+
+    friend std::ptrdiff_t operator-(const counting_sentinel& sentinel, const int* iterator)
+        requires SizedV
+    {
+        return sentinel.end - iterator;
+    }
+
+    friend std::ptrdiff_t operator-(const int* iterator, const counting_sentinel& sentinel)
+        requires SizedV
+    {
+        return iterator - sentinel.end;
+    }
+};
+
+TEST(IteratorTest, contiguous_optimization) {
+    const int values[]{1, 2, 3, 0};
+    auto      comparisons = std::ptrdiff_t{};
+    auto      subrange    = std::ranges::subrange{values, counting_sentinel<true>{values + 3, &comparisons}};
+    any_view<const int, contiguous> view{subrange};
+
+    auto it = view.begin();
+
+    // iterating optimized contiguous iterator with sized sentinel does not compare underlying iterator
+    comparisons = 0;
+    int sum     = 0;
+    for (; it != view.end(); ++it) {
+        sum += *it;
+    }
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(comparisons, 0);
+
+    --it;
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(it - view.begin(), 2);
+
+    // an empty range with a non-null address ends immediately
+    any_view<const int, contiguous> empty{std::span{values + 1, values + 1}};
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TEST(IteratorTest, contiguous_unsized_sentinel) {
+    const int values[]{1, 2, 3, 0};
+    auto      comparisons = std::ptrdiff_t{};
+    auto      subrange    = std::ranges::subrange{values, counting_sentinel<false>{values + 3, &comparisons}};
+    any_view<const int, contiguous> view{subrange};
+
+    // a null-terminated range still compares its underlying iterator with its sentinel
+    int sum = 0;
+    for (auto it = view.begin(); it != view.end(); ++it) {
+        sum += *it;
+    }
+    EXPECT_EQ(sum, 6);
+    EXPECT_GT(comparisons, 0);
+}
+
+TEST(IteratorTest, contiguous_erased_as_pointers) {
+    std::vector<int> vec{1, 2, 3, 4};
+
+    // contiguous iterators with a sized sentinel are erased as pointers into the same elements
+    any_view<int, random_access> views[]{
+        any_view<int, random_access>{vec},
+        any_view<int, random_access>{std::span{vec}},
+        any_view<int, random_access>{std::views::drop(vec, 1)},
+        any_view<int, random_access>{std::vector{1, 2, 3, 4}},
+    };
+
+    EXPECT_TRUE(std::ranges::equal(views[0], vec));
+    EXPECT_TRUE(std::ranges::equal(views[1], vec));
+    EXPECT_TRUE(std::ranges::equal(views[2], std::vector{2, 3, 4}));
+    EXPECT_TRUE(std::ranges::equal(views[3], vec));
+
+    auto it = std::ranges::next(views[2].begin(), views[2].end());
+    --it;
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(it - views[2].begin(), 2);
+    EXPECT_EQ(&views[1].begin()[2], &vec[2]);
+}
+
+TEST(IteratorTest, random_access_sentinel) {
+    auto transformed =
+        std::views::iota(0, 5) | std::views::transform([](int n) { return "val_" + std::to_string(n); });
+    auto offset   = std::ptrdiff_t{};
+    auto begin    = tracing_iterator{transformed.begin(), &offset};
+    auto subrange = std::ranges::subrange{begin, begin + 5};
+
+    // comparing with the sentinel accounts for the index of an unsized iterator
+    any_random_access_view<std::string> unsized_view{transformed};
+    std::string                         joined;
+    for (const auto& value : unsized_view) {
+        joined += value;
+    }
+    EXPECT_EQ(joined, "val_0val_1val_2val_3val_4");
+
+    // comparing a sized iterator with the sentinel does not advance the underlying iterator
+    any_view<std::string, random_access | sized, std::string> sized_view{subrange};
+    std::ptrdiff_t                                            count = 0;
+
+    offset = 0;
+    for (auto it = sized_view.begin(); it != sized_view.end(); ++it) {
+        ++count;
+    }
+    EXPECT_EQ(count, 5);
+    EXPECT_EQ(offset, 0);
+}
+
+TEST(IteratorTest, converted_batches) {
+    any_view<int, forward, int>   inner{std::views::iota(0, 40)};
+    any_view<long, forward, long> view{std::move(inner)};
+
+    auto expected = 0l;
+
+    for (const long value : view) {
+        EXPECT_EQ(value, expected++);
+    }
+
+    EXPECT_EQ(expected, 40);
+
+    // iterators at the same element compare equal across batches
+    auto it1 = std::ranges::next(view.begin(), 20);
+    auto it2 = view.begin();
+
+    EXPECT_NE(it1, it2);
+    std::ranges::advance(it2, 20);
+    EXPECT_EQ(it1, it2);
+    EXPECT_EQ(*it1, 20);
+
+    // references from an input view are fetched one at a time, so that they do not dangle
+    std::istringstream          in{"1 2 3"};
+    any_view<long, input, long> input_view{any_view<int>{std::views::istream<int>(in)}};
+    std::vector<long>           values;
+
+    for (const long value : input_view) {
+        values.push_back(value);
+    }
+
+    EXPECT_EQ(values, (std::vector<long>{1, 2, 3}));
+}
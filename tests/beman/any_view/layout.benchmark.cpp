@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/any_view.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using beman::any_view::any_view;
+using enum beman::any_view::any_view_options;
+
+constexpr auto max_size   = 1 << 12;
+constexpr auto type_count = 512;
+
+const auto global_values = [] {
+    std::vector<int> values(max_size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}();
+
+// each view has its own type, and so its own witnesses and functions
+template <class AnyViewT, std::size_t... Is>
+[[nodiscard]] std::vector<AnyViewT> make_views(std::size_t size, std::index_sequence<Is...>) {
+    std::vector<AnyViewT> views;
+    (views.emplace_back(global_values | std::views::take(size) |
+                        std::views::transform([](int value) { return value + static_cast<int>(Is); })),
+     ...);
+    return views;
+}
+
+// advances one iterator of each view in turn, so that the witnesses of every type compete for the cache at each step
+template <class AnyViewT>
+static void BM_interleaved(benchmark::State& state) {
+    const auto size  = static_cast<std::size_t>(state.range(0));
+    auto       views = make_views<AnyViewT>(size, std::make_index_sequence<type_count>{});
+
+    std::vector<std::ranges::iterator_t<AnyViewT>> iterators;
+    iterators.reserve(views.size());
+
+    for (auto _ : state) {
+        iterators.clear();
+
+        for (auto& view : views) {
+            iterators.push_back(view.begin());
+        }
+
+        auto sum = 0;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            for (auto& it : iterators) {
+                sum += *it;
+                ++it;
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * views.size() * size));
+}
+
+BENCHMARK(BM_interleaved<any_view<int, input, int>>)->RangeMultiplier(8)->Range(1 << 3, max_size);
+BENCHMARK(BM_interleaved<any_view<int, forward, int>>)->RangeMultiplier(8)->Range(1 << 3, max_size);
+BENCHMARK(BM_interleaved<any_view<int, random_access, int>>)->RangeMultiplier(8)->Range(1 << 3, max_size);
+
+BENCHMARK_MAIN();
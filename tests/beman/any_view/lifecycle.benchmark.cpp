@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/any_view.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+using beman::any_view::any_view;
+using enum beman::any_view::any_view_options;
+
+namespace {
+
+std::size_t global_allocations = 0;
+
+const auto global_values = [] {
+    std::vector<int> values(64);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}();
+
+template <std::size_t WordsV>
+struct padding {
+    std::array<const void*, WordsV> words{};
+};
+
+template <>
+struct padding<0> {};
+
+// forward view whose view and iterator adaptors are ViewWordsV and IteratorWordsV pointers large, so that they can
+// be swept across the inplace thresholds of view_storage and iterator_storage
+template <std::size_t ViewWordsV, std::size_t IteratorWordsV>
+    requires(ViewWordsV >= 2 and IteratorWordsV >= 2)
+class padded_view : public std::ranges::view_interface<padded_view<ViewWordsV, IteratorWordsV>> {
+    const int* first;
+    const int* last;
+    BEMAN_ANY_VIEW_NO_UNIQUE_ADDRESS padding<ViewWordsV - 2> view_padding;
+
+  public:
+    struct sentinel {
+        const int* last;
+    };
+
+    struct iterator {
+        using value_type      = int;
+        using difference_type = std::ptrdiff_t;
+
+        const int* current = nullptr;
+        BEMAN_ANY_VIEW_NO_UNIQUE_ADDRESS padding<IteratorWordsV - 2> iterator_padding;
+
+        const int& operator*() const noexcept { return *current; }
+
+        iterator& operator++() noexcept {
+            ++current;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept { return {current++, iterator_padding}; }
+
+        bool operator==(const iterator& other) const noexcept { return current == other.current; }
+
+        bool operator==(const sentinel& other) const noexcept { return current == other.last; }
+    };
+
+    padded_view() = default;
+
+    explicit padded_view(const std::vector<int>& values) noexcept
+        : first(values.data()), last(values.data() + values.size()) {}
+
+    iterator begin() const noexcept { return {first}; }
+
+    sentinel end() const noexcept { return {last}; }
+};
+
+static_assert(sizeof(padded_view<2, 2>) == 2 * sizeof(void*));
+static_assert(sizeof(padded_view<4, 2>) == 4 * sizeof(void*));
+static_assert(sizeof(std::ranges::iterator_t<padded_view<2, 3>>) == 2 * sizeof(void*));
+
+using lifecycle_view = any_view<const int, forward | copyable>;
+
+// reports the average number of heap allocations per iteration
+class allocation_scope {
+    benchmark::State& state;
+    std::size_t       allocations = global_allocations;
+
+  public:
+    explicit allocation_scope(benchmark::State& state) noexcept : state(state) {}
+
+    ~allocation_scope() {
+        state.counters["allocations"] = benchmark::Counter(static_cast<double>(global_allocations - allocations),
+                                                           benchmark::Counter::kAvgIterations);
+    }
+};
+
+} // namespace
+
+// counts heap allocations, including those of the type erasure when an adaptor does not fit inplace
+void* operator new(std::size_t size) {
+    ++global_allocations;
+
+    if (const auto ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+template <class ViewT>
+static void BM_lifecycle_construct(benchmark::State& state) {
+    ViewT                  source{global_values};
+    const allocation_scope scope{state};
+
+    for (auto _ : state) {
+        lifecycle_view view{source};
+        benchmark::DoNotOptimize(view);
+    }
+}
+
+template <class ViewT>
+static void BM_lifecycle_move(benchmark::State& state) {
+    lifecycle_view         view{ViewT{global_values}};
+    const allocation_scope scope{state};
+
+    for (auto _ : state) {
+        lifecycle_view other{std::move(view)};
+        benchmark::DoNotOptimize(other);
+        view = std::move(other);
+    }
+}
+
+template <class ViewT>
+static void BM_lifecycle_copy(benchmark::State& state) {
+    const lifecycle_view   view{ViewT{global_values}};
+    const allocation_scope scope{state};
+
+    for (auto _ : state) {
+        lifecycle_view other{view};
+        benchmark::DoNotOptimize(other);
+    }
+}
+
+template <class ViewT>
+static void BM_lifecycle_swap(benchmark::State& state) {
+    lifecycle_view         view{ViewT{global_values}};
+    lifecycle_view         other{ViewT{global_values}};
+    const allocation_scope scope{state};
+
+    for (auto _ : state) {
+        std::ranges::swap(view, other);
+        benchmark::DoNotOptimize(view);
+    }
+}
+
+template <class ViewT>
+static void BM_lifecycle_begin(benchmark::State& state) {
+    lifecycle_view         view{ViewT{global_values}};
+    const allocation_scope scope{state};
+
+    for (auto _ : state) {
+        auto it = view.begin();
+        benchmark::DoNotOptimize(it);
+    }
+}
+
+template <class ViewT>
+static void BM_lifecycle_iterator_copy(benchmark::State& state) {
+    lifecycle_view         view{ViewT{global_values}};
+    const auto             it = view.begin();
+    const allocation_scope scope{state};
+
+    for (auto _ : state) {
+        auto other = it;
+        benchmark::DoNotOptimize(other);
+    }
+}
+
+template <class ViewT>
+static void BM_lifecycle_iterator_move(benchmark::State& state) {
+    lifecycle_view         view{ViewT{global_values}};
+    auto                   it = view.begin();
+    const allocation_scope scope{state};
+
+    for (auto _ : state) {
+        auto other = std::move(it);
+        benchmark::DoNotOptimize(other);
+        it = std::move(other);
+    }
+}
+
+// view adaptors of 2 and 3 pointers are stored inplace, and of 4 pointers are allocated
+BENCHMARK(BM_lifecycle_construct<padded_view<2, 2>>);
+BENCHMARK(BM_lifecycle_construct<padded_view<3, 2>>);
+BENCHMARK(BM_lifecycle_construct<padded_view<4, 2>>);
+BENCHMARK(BM_lifecycle_move<padded_view<2, 2>>);
+BENCHMARK(BM_lifecycle_move<padded_view<3, 2>>);
+BENCHMARK(BM_lifecycle_move<padded_view<4, 2>>);
+BENCHMARK(BM_lifecycle_copy<padded_view<2, 2>>);
+BENCHMARK(BM_lifecycle_copy<padded_view<3, 2>>);
+BENCHMARK(BM_lifecycle_copy<padded_view<4, 2>>);
+BENCHMARK(BM_lifecycle_swap<padded_view<2, 2>>);
+BENCHMARK(BM_lifecycle_swap<padded_view<3, 2>>);
+BENCHMARK(BM_lifecycle_swap<padded_view<4, 2>>);
+
+// iterator adaptors of 2 pointers are stored inplace, and of 3 pointers are allocated
+BENCHMARK(BM_lifecycle_begin<padded_view<2, 2>>);
+BENCHMARK(BM_lifecycle_begin<padded_view<2, 3>>);
+BENCHMARK(BM_lifecycle_iterator_copy<padded_view<2, 2>>);
+BENCHMARK(BM_lifecycle_iterator_copy<padded_view<2, 3>>);
+BENCHMARK(BM_lifecycle_iterator_move<padded_view<2, 2>>);
+BENCHMARK(BM_lifecycle_iterator_move<padded_view<2, 3>>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/parallel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::parallel_for_each;
+using beman::any_view::parallel_reduce;
+using enum beman::any_view::any_view_options;
+
+TEST(ParallelTest, for_each) {
+    std::vector<int> vec(1000);
+    std::iota(vec.begin(), vec.end(), 0);
+    any_view<int, random_access | sized> view{vec};
+
+    parallel_for_each(view, [](int& value) { value *= 2; }, 4);
+
+    for (std::size_t index = 0; index != vec.size(); ++index) {
+        EXPECT_EQ(vec[index], 2 * static_cast<int>(index));
+    }
+}
+
+TEST(ParallelTest, for_each_count) {
+    std::atomic<int>                      count = 0;
+    any_view<int, random_access | sized, int> view{std::views::iota(0, 1000)};
+
+    for (std::size_t thread_count : {0, 1, 3, 8, 2000}) {
+        count = 0;
+        parallel_for_each(view, [&](int) { ++count; }, thread_count);
+        EXPECT_EQ(count, 1000);
+    }
+}
+
+TEST(ParallelTest, reduce) {
+    auto transformed = std::views::iota(1, 101) | std::views::transform([](int n) { return n * n; });
+    any_view<int, random_access | sized, int> view{transformed};
+
+    EXPECT_EQ(parallel_reduce(view, 0), 338350);
+    EXPECT_EQ(parallel_reduce(view, 1, std::plus<>{}, 7), 338351);
+    EXPECT_EQ(parallel_reduce(view, 0, [](int lhs, int rhs) { return std::max(lhs, rhs); }), 10000);
+}
+
+TEST(ParallelTest, reduce_empty) {
+    any_view<const int, random_access | sized> view{std::vector<int>{}};
+
+    EXPECT_EQ(parallel_reduce(view, 42), 42);
+}
+
+TEST(ParallelTest, reduce_string) {
+    std::vector<std::string>                         vec{"a", "b", "c", "d", "e"};
+    any_view<const std::string, random_access | sized> view{vec};
+
+    // concatenation is associative, so slices are combined in order
+    EXPECT_EQ(parallel_reduce(view, std::string{}, std::plus<>{}, 2), "abcde");
+}
+
+TEST(ParallelTest, exception) {
+    any_view<int, random_access | sized, int> view{std::views::iota(0, 100)};
+
+    EXPECT_THROW(parallel_for_each(
+                     view,
+                     [](int value) {
+                         if (value == 10) {
+                             throw std::runtime_error{"error"};
+                         }
+                     },
+                     4),
+                 std::runtime_error);
+}
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/prefetch.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::prefetch;
+using enum beman::any_view::any_view_options;
+
+namespace {
+
+template <class RangeT>
+auto to_vector(RangeT&& range) {
+    std::vector<std::ranges::range_value_t<RangeT>> result;
+
+    for (auto&& element : range) {
+        result.push_back(std::move(element));
+    }
+
+    return result;
+}
+
+} // namespace
+
+TEST(PrefetchTest, istream) {
+    std::istringstream in{"1 2 3 4 5 6 7"};
+    auto               view = prefetch(any_view<int>{std::views::istream<int>(in)}, 3, 2);
+
+    static_assert(std::same_as<decltype(view), any_view<int>>);
+    EXPECT_EQ(to_vector(view), (std::vector{1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST(PrefetchTest, batch_boundaries) {
+    for (int size : {0, 1, 4, 5, 8, 100}) {
+        std::vector<int> expected;
+
+        for (int value = 0; value != size; ++value) {
+            expected.push_back(value);
+        }
+
+        EXPECT_EQ(to_vector(prefetch(any_view<int, input, int>{std::views::iota(0, size)}, 4, 2)), expected);
+    }
+}
+
+TEST(PrefetchTest, move_only) {
+    std::vector<std::unique_ptr<int>> elements;
+    elements.push_back(std::make_unique<int>(1));
+    elements.push_back(std::make_unique<int>(2));
+
+    auto view = prefetch(any_view<std::unique_ptr<int>, input, std::unique_ptr<int>&>{elements});
+
+    const auto result = to_vector(view);
+
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(*result[0], 1);
+    EXPECT_EQ(*result[1], 2);
+    EXPECT_EQ(elements[0], nullptr);
+}
+
+TEST(PrefetchTest, string) {
+    std::istringstream in{"prefetch any view"};
+    auto               view = prefetch(any_view<std::string>{std::views::istream<std::string>(in)}, 1, 1);
+
+    EXPECT_EQ(to_vector(view), (std::vector<std::string>{"prefetch", "any", "view"}));
+}
+
+TEST(PrefetchTest, exception) {
+    auto throwing = std::views::iota(0) | std::views::transform([](int value) {
+                        if (value == 5) {
+                            throw std::runtime_error{"prefetch"};
+                        }
+
+                        return value;
+                    });
+
+    auto view = prefetch(any_view<int, input, int>{throwing}, 2, 2);
+    auto it   = view.begin();
+
+    EXPECT_THROW(
+        {
+            for (int count = 0; count != 10; ++count, ++it) {
+                EXPECT_EQ(*it, count);
+            }
+        },
+        std::runtime_error);
+}
+
+TEST(PrefetchTest, early_destruction) {
+    auto view = prefetch(any_view<int, input, int>{std::views::iota(0)}, 4, 2);
+    auto it   = view.begin();
+
+    EXPECT_EQ(*it, 0);
+    ++it;
+    EXPECT_EQ(*it, 1);
+}
+
+TEST(PrefetchTest, unstarted) {
+    auto view = prefetch(any_view<int, input, int>{std::views::iota(0)});
+    static_cast<void>(view);
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/pushdown.hpp>
+#include <beman/any_view/slice.hpp>
+#include <beman/any_view/target.hpp>
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::drop;
+using beman::any_view::reverse;
+using beman::any_view::slice;
+using beman::any_view::take;
+using beman::any_view::target;
+using enum beman::any_view::any_view_options;
+
+template <class AnyViewT>
+auto to_vector(AnyViewT&& view) {
+    std::vector<std::ranges::range_value_t<AnyViewT>> result;
+
+    for (auto&& value : view) {
+        result.push_back(value);
+    }
+
+    return result;
+}
+
+constexpr auto sum(any_view<const int, random_access | sized> view) {
+    auto result = 0;
+
+    for (const int value : take(drop(std::move(view), 1), 3)) {
+        result += value;
+    }
+
+    return result;
+}
+
+TEST(PushdownTest, sum_vector) {
+#ifndef _MSC_VER
+    // error C2131: expression did not evaluate to a constant
+    static_assert(9 == sum(std::vector{1, 2, 3, 4, 5}));
+#endif
+    EXPECT_EQ(9, sum(std::vector{1, 2, 3, 4, 5}));
+}
+
+TEST(PushdownTest, take_input) {
+    any_view<int, input, int> view{std::views::iota(0) | std::views::filter([](int n) { return n % 2 == 0; })};
+
+    EXPECT_EQ(to_vector(take(take(std::move(view), 5), 3)), (std::vector{0, 2, 4}));
+}
+
+TEST(PushdownTest, drop_forward) {
+    std::list<int>                    list{1, 2, 3, 4, 5, 6};
+    any_view<int, forward | copyable> view{list};
+
+    EXPECT_EQ(to_vector(drop(take(view, 5), 2)), (std::vector{3, 4, 5}));
+    EXPECT_EQ(to_vector(take(drop(view, 2), 2)), (std::vector{3, 4}));
+    EXPECT_EQ(to_vector(drop(drop(view, 1), 1)), (std::vector{3, 4, 5, 6}));
+    EXPECT_TRUE(drop(view, 7).empty());
+    EXPECT_TRUE(take(view, 0).empty());
+}
+
+TEST(PushdownTest, sized) {
+    std::vector<int>                                vec{1, 2, 3, 4, 5};
+    any_view<int, random_access | sized | copyable> view{vec};
+
+    EXPECT_EQ(take(view, 3).size(), 3);
+    EXPECT_EQ(take(view, 9).size(), 5);
+    EXPECT_EQ(drop(view, 4).size(), 1);
+    EXPECT_EQ(drop(view, 7).size(), 0);
+
+    auto window = take(drop(view, 1), 2);
+
+    EXPECT_EQ(to_vector(window), (std::vector{2, 3}));
+    EXPECT_EQ(window[1], 3);
+    EXPECT_EQ(std::ranges::distance(window), 2);
+    EXPECT_EQ(to_vector(slice(window, 1, 2)), (std::vector{3}));
+}
+
+TEST(PushdownTest, owning) {
+    auto view = take(any_view<std::string, forward>(std::vector<std::string>{"a", "b", "c"}), 2);
+
+    EXPECT_EQ(to_vector(view), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(to_vector(drop(std::move(view), 1)), (std::vector<std::string>{"b"}));
+}
+
+TEST(PushdownTest, reverse_bidirectional) {
+    std::list<int>                          list{1, 2, 3, 4, 5, 6};
+    any_view<int, bidirectional | copyable> view{list};
+
+    EXPECT_EQ(to_vector(reverse(view)), (std::vector{6, 5, 4, 3, 2, 1}));
+
+    // reversing a reversed view restores the view, rather than erasing the reversed view again
+    EXPECT_NE(target<std::list<int>>(reverse(reverse(view))), nullptr);
+
+    auto reversed = reverse(take(drop(view, 1), 3));
+
+    EXPECT_EQ(to_vector(reversed), (std::vector{4, 3, 2}));
+    EXPECT_EQ(to_vector(take(reversed, 2)), (std::vector{4, 3}));
+    EXPECT_EQ(to_vector(reverse(take(reversed, 2))), (std::vector{3, 4}));
+    EXPECT_EQ(to_vector(reverse(drop(view, 9))), std::vector<int>{});
+}
+
+TEST(PushdownTest, reverse_random_access) {
+    std::vector<int>                                vec{1, 2, 3, 4, 5};
+    any_view<int, random_access | sized | copyable> view{vec};
+
+    auto reversed = reverse(view);
+
+    EXPECT_EQ(reversed.size(), 5);
+    EXPECT_EQ(reversed[0], 5);
+    EXPECT_EQ(to_vector(slice(reversed, 1, 3)), (std::vector{4, 3}));
+    EXPECT_EQ(to_vector(reverse(drop(reversed, 3))), (std::vector{1, 2}));
+
+    // reversing a slice reverses its iterators, rather than erasing the reversed slice again
+    auto sliced = slice(view, 1, 4);
+
+    EXPECT_EQ(to_vector(reverse(sliced)), (std::vector{4, 3, 2}));
+    ASSERT_NE(target<std::ranges::subrange<std::vector<int>::iterator>>(reverse(reverse(sliced))), nullptr);
+}
+
+TEST(PushdownTest, lvalue_reference) {
+    std::vector<int>              vec{1, 2, 3, 4};
+    any_view<int, random_access> view{vec};
+
+    for (int& value : reverse(take(std::move(view), 2))) {
+        value *= 10;
+    }
+
+    EXPECT_EQ(vec, (std::vector{10, 20, 3, 4}));
+}
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/any_view.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <span>
+#include <vector>
+
+using beman::any_view::any_view;
+using enum beman::any_view::any_view_options;
+
+// inplace but not trivially copyable
+class shared_vector_view : public std::ranges::view_interface<shared_vector_view> {
+    std::shared_ptr<std::vector<int>> vec;
+
+  public:
+    explicit shared_vector_view(std::vector<int> vec) : vec(std::make_shared<std::vector<int>>(std::move(vec))) {}
+
+    auto begin() const { return vec->begin(); }
+    auto end() const { return vec->end(); }
+};
+
+template <class AnyViewT>
+std::vector<int> to_vector(AnyViewT& view) {
+    std::vector<int> result;
+
+    for (const int value : view) {
+        result.push_back(value);
+    }
+
+    return result;
+}
+
+TEST(RelocationTest, swap_mixed) {
+    std::vector<int> vec{1, 2, 3};
+    std::array       arr{4, 5};
+
+    // trivially copyable inplace, non-trivially copyable inplace, and heap allocated adaptors
+    std::vector<any_view<int, forward | copyable, int>> views;
+    views.emplace_back(std::span{vec});
+    views.emplace_back(shared_vector_view{{6, 7}});
+    views.emplace_back(std::views::transform(arr, [padding = std::array<int, 8>{}](int n) { return n + padding[0]; }));
+
+    std::ranges::reverse(views);
+    std::ranges::rotate(views, views.begin() + 1);
+
+    EXPECT_EQ(to_vector(views[0]), (std::vector{6, 7}));
+    EXPECT_EQ(to_vector(views[1]), (std::vector{1, 2, 3}));
+    EXPECT_EQ(to_vector(views[2]), (std::vector{4, 5}));
+
+    auto copies = views;
+    views.clear();
+
+    EXPECT_EQ(to_vector(copies[0]), (std::vector{6, 7}));
+    EXPECT_EQ(to_vector(copies[1]), (std::vector{1, 2, 3}));
+    EXPECT_EQ(to_vector(copies[2]), (std::vector{4, 5}));
+}
+
+TEST(RelocationTest, iterator_copy) {
+    std::vector<int>       vec{1, 2, 3};
+    any_view<int, forward> view{vec};
+
+    auto it   = view.begin();
+    auto copy = it;
+    ++it;
+
+    EXPECT_EQ(*copy, 1);
+    EXPECT_EQ(*it, 2);
+
+    copy = std::move(it);
+
+    EXPECT_EQ(*copy, 2);
+}
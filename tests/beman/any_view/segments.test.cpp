@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/segments.hpp>
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <list>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::segments;
+using enum beman::any_view::any_view_options;
+
+template <class AnyViewT>
+auto segment_sizes(AnyViewT view) {
+    std::vector<std::size_t> sizes;
+
+    for (auto segment : segments(std::move(view))) {
+        sizes.push_back(segment.size());
+    }
+
+    return sizes;
+}
+
+constexpr auto sum(any_view<const int, forward> view) {
+    auto result = 0;
+
+    for (auto segment : segments(std::move(view))) {
+        for (const int value : segment) {
+            result += value;
+        }
+    }
+
+    return result;
+}
+
+TEST(SegmentsTest, sum_vector) {
+#ifndef _MSC_VER
+    // error C2131: expression did not evaluate to a constant
+    static_assert(15 == sum(std::vector{1, 2, 3, 4, 5}));
+#endif
+    EXPECT_EQ(15, sum(std::vector{1, 2, 3, 4, 5}));
+}
+
+TEST(SegmentsTest, contiguous) {
+    EXPECT_EQ(segment_sizes(any_view<int, forward>{std::vector<int>(10)}), (std::vector<std::size_t>{10}));
+    EXPECT_TRUE(segment_sizes(any_view<int, forward>{std::vector<int>{}}).empty());
+    EXPECT_TRUE(segment_sizes(any_view<int, forward>{}).empty());
+}
+
+TEST(SegmentsTest, deque) {
+    std::deque<int> deq(10000);
+    std::iota(deq.begin(), deq.end(), 0);
+
+    const auto sizes = segment_sizes(any_view<int, random_access>{deq});
+
+    EXPECT_LT(sizes.size(), deq.size());
+    EXPECT_EQ(std::accumulate(sizes.begin(), sizes.end(), std::size_t{}), deq.size());
+    EXPECT_EQ(sum(deq), std::accumulate(deq.begin(), deq.end(), 0));
+}
+
+TEST(SegmentsTest, join) {
+    std::vector<std::vector<int>> vecs{{1, 2, 3}, {}, {4, 5}, {6}};
+
+    const auto sizes = segment_sizes(any_view<int, bidirectional>{vecs | std::views::join});
+
+    EXPECT_LE(sizes.size(), 3);
+    EXPECT_EQ(std::accumulate(sizes.begin(), sizes.end(), std::size_t{}), 6);
+    EXPECT_EQ(sum(vecs | std::views::join), 21);
+}
+
+TEST(SegmentsTest, lvalue_reference) {
+    std::list<int> list{1, 2, 3};
+
+    for (auto segment : segments(any_view<int, forward>{list})) {
+        for (int& value : segment) {
+            value *= 2;
+        }
+    }
+
+    EXPECT_EQ(list, (std::list{2, 4, 6}));
+}
+
+TEST(SegmentsTest, input_reference) {
+    // references into std::views::istream are invalidated by increment, so each segment holds a single element
+    std::istringstream in{"1 2 3 4"};
+
+    EXPECT_EQ(segment_sizes(any_view<const int>{std::views::istream<int>(in)}),
+              (std::vector<std::size_t>{1, 1, 1, 1}));
+}
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/any_view.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+using beman::any_view::any_view;
+using enum beman::any_view::any_view_options;
+
+// owning view which counts how many times it is copied
+class counted_view : public std::ranges::view_interface<counted_view> {
+    std::vector<int> vec;
+    int*             copies;
+
+  public:
+    counted_view(std::vector<int> vec, int& copies) : vec(std::move(vec)), copies(&copies) {}
+
+    counted_view(const counted_view& other) : vec(other.vec), copies(other.copies) { ++*copies; }
+
+    counted_view(counted_view&&) noexcept = default;
+
+    counted_view& operator=(const counted_view& other) {
+        vec    = other.vec;
+        copies = other.copies;
+        ++*copies;
+        return *this;
+    }
+
+    counted_view& operator=(counted_view&&) noexcept = default;
+
+    auto begin() { return vec.begin(); }
+    auto end() { return vec.end(); }
+    auto begin() const { return vec.begin(); }
+    auto end() const { return vec.end(); }
+};
+
+template <class AnyViewT>
+int sum(AnyViewT& view) {
+    auto result = 0;
+
+    for (const int value : view) {
+        result += value;
+    }
+
+    return result;
+}
+
+TEST(SharedTest, const_copies) {
+    auto                                  copies = 0;
+    any_view<const int, forward | shared> view{counted_view{{1, 2, 3}, copies}};
+
+    auto copy1 = view;
+    auto copy2 = copy1;
+
+    EXPECT_EQ(sum(view), 6);
+    EXPECT_EQ(sum(copy1), 6);
+    EXPECT_EQ(sum(copy2), 6);
+    EXPECT_EQ(copies, 0);
+}
+
+TEST(SharedTest, copy_on_write) {
+    auto                            copies = 0;
+    any_view<int, forward | shared> view{counted_view{{1, 2, 3}, copies}};
+
+    auto copy = view;
+    EXPECT_EQ(copies, 0);
+
+    for (int& value : copy) {
+        value *= 2;
+    }
+
+    EXPECT_EQ(copies, 1);
+    EXPECT_EQ(sum(copy), 12);
+    EXPECT_EQ(sum(view), 6);
+    // both views are now unique
+    EXPECT_EQ(copies, 1);
+}
+
+TEST(SharedTest, owning_view) {
+    // std::ranges::owning_view is move-only, so it is cloned by copying the std::vector it owns
+    any_view<int, forward | shared> view{std::vector{1, 2, 3}};
+
+    auto copy = view;
+
+    for (int& value : copy) {
+        value *= 2;
+    }
+
+    EXPECT_EQ(sum(copy), 12);
+    EXPECT_EQ(sum(view), 6);
+}
+
+TEST(SharedTest, sized) {
+    auto                                                copies = 0;
+    any_view<const int, random_access | sized | shared> view{counted_view{{1, 2, 3}, copies}};
+
+    auto copy = view;
+
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_EQ(copy[1], 2);
+    EXPECT_EQ(copies, 0);
+}
+
+TEST(SharedTest, shared_is_copyable) {
+    static_assert(std::copyable<any_view<int, input | shared>>);
+    static_assert((shared & copyable) == copyable);
+}
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/slice.hpp>
+#include <beman/any_view/target.hpp>
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::slice;
+using beman::any_view::target;
+using enum beman::any_view::any_view_options;
+
+template <class AnyViewT>
+auto to_vector(AnyViewT&& view) {
+    std::vector<std::ranges::range_value_t<AnyViewT>> result;
+
+    for (auto&& value : view) {
+        result.push_back(value);
+    }
+
+    return result;
+}
+
+constexpr auto sum(any_view<const int, random_access | sized> view, std::ptrdiff_t first, std::ptrdiff_t last) {
+    auto result = 0;
+
+    for (const int value : slice(view, first, last)) {
+        result += value;
+    }
+
+    return result;
+}
+
+TEST(SliceTest, sum_vector) {
+#ifndef _MSC_VER
+    // error C2131: expression did not evaluate to a constant
+    static_assert(9 == sum(std::vector{1, 2, 3, 4, 5}, 1, 4));
+#endif
+    EXPECT_EQ(9, sum(std::vector{1, 2, 3, 4, 5}, 1, 4));
+}
+
+TEST(SliceTest, bounds) {
+    std::vector<int>                     vec{1, 2, 3, 4, 5};
+    any_view<int, random_access | sized> view{vec};
+
+    EXPECT_EQ(to_vector(slice(view, 0, 5)), vec);
+    EXPECT_EQ(to_vector(slice(view, 2, 4)), (std::vector{3, 4}));
+    EXPECT_TRUE(slice(view, 3, 3).empty());
+    EXPECT_EQ(slice(view, 1, 4).size(), 3);
+}
+
+TEST(SliceTest, nested) {
+    std::deque<int>                      deq{1, 2, 3, 4, 5, 6};
+    any_view<int, random_access | sized> view{deq};
+
+    auto outer = slice(view, 1, 6);
+    auto inner = slice(outer, 1, 3);
+
+    EXPECT_EQ(to_vector(inner), (std::vector{3, 4}));
+
+    // a slice of a slice has the same adaptor as the slice, rather than erasing the slice again
+    using subrange_type = std::ranges::subrange<std::deque<int>::iterator>;
+    ASSERT_NE(target<subrange_type>(outer), nullptr);
+    ASSERT_NE(target<subrange_type>(inner), nullptr);
+    EXPECT_EQ(target<subrange_type>(inner)->begin(), deq.begin() + 2);
+}
+
+TEST(SliceTest, lvalue_reference) {
+    std::vector<int>                     vec{1, 2, 3};
+    any_view<int, random_access | sized> view{vec};
+
+    for (int& value : slice(view, 1, 3)) {
+        value *= 2;
+    }
+
+    EXPECT_EQ(vec, (std::vector{1, 4, 6}));
+}
+
+TEST(SliceTest, transform) {
+    auto transformed = std::views::iota(0, 10) | std::views::transform([](int n) { return std::to_string(n); });
+    any_view<std::string, random_access | sized | copyable, std::string> view{transformed};
+
+    auto sliced = slice(view, 7, 10);
+    auto copy   = sliced;
+
+    EXPECT_EQ(to_vector(std::move(copy)), (std::vector<std::string>{"7", "8", "9"}));
+    EXPECT_EQ(sliced[1], "8");
+}
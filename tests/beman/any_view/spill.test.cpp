@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/spill.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <deque>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::iterator_spills_v;
+using beman::any_view::set_spill_handler;
+using beman::any_view::spill_info;
+using beman::any_view::spill_kind;
+using beman::any_view::view_spills_v;
+using enum beman::any_view::any_view_options;
+
+static_assert(not view_spills_v<any_view<int>, std::vector<int>&>);
+static_assert(not iterator_spills_v<any_view<int>, std::vector<int>&>);
+static_assert(not view_spills_v<any_view<int>, std::deque<int>&>);
+static_assert(iterator_spills_v<any_view<int>, std::deque<int>&>);
+static_assert(view_spills_v<any_view<int>, std::ranges::subrange<std::deque<int>::iterator>>);
+
+namespace {
+
+std::vector<spill_info> spills;
+
+void record(const spill_info& info) { spills.push_back(info); }
+
+// registers record for the scope of a test
+struct recording {
+    beman::any_view::spill_handler previous = set_spill_handler(record);
+
+    recording() { spills.clear(); }
+
+    ~recording() { set_spill_handler(previous); }
+};
+
+} // namespace
+
+TEST(SpillTest, inplace) {
+    const recording scope;
+
+    std::vector<int> vec{1, 2, 3};
+    any_view<int>    view{vec};
+
+    for ([[maybe_unused]] int value : view) {
+    }
+
+    EXPECT_TRUE(spills.empty());
+}
+
+TEST(SpillTest, iterator) {
+    const recording scope;
+
+    std::deque<int> deq{1, 2, 3};
+    any_view<int>   view{deq};
+
+    EXPECT_TRUE(spills.empty());
+
+    auto it = view.begin();
+
+    ASSERT_EQ(spills.size(), 1);
+    EXPECT_EQ(spills[0].kind, spill_kind::iterator);
+    EXPECT_EQ(spills[0].size, 2 * sizeof(std::deque<int>::iterator));
+    EXPECT_EQ(spills[0].inplace_size, 2 * sizeof(void*));
+    EXPECT_TRUE(spills[0].nothrow_move_constructible);
+    EXPECT_FALSE(spills[0].type_name.empty());
+    EXPECT_EQ(*it, 1);
+}
+
+TEST(SpillTest, view) {
+    const recording scope;
+
+    std::array<int, 8> captured{};
+    auto transform = std::views::iota(0, 3) | std::views::transform([captured](int n) { return n + captured[0]; });
+
+    any_view<int, input, int> view{transform};
+
+    ASSERT_EQ(spills.size(), 1);
+    EXPECT_EQ(spills[0].kind, spill_kind::view);
+    EXPECT_GE(spills[0].size, sizeof(captured));
+    EXPECT_EQ(spills[0].inplace_size, 3 * sizeof(void*));
+    EXPECT_NE(spills[0].type_name.find("transform_view"), std::string_view::npos);
+}
+
+TEST(SpillTest, unregistered) {
+    std::deque<int> deq{1, 2, 3};
+    any_view<int>   view{deq};
+
+    {
+        const recording scope;
+    }
+
+    auto it = view.begin();
+
+    EXPECT_TRUE(spills.empty());
+    EXPECT_EQ(*it, 1);
+}
@@ -6,6 +6,8 @@
 #include "detail/products.hpp"
 #include "detail/reserved.hpp"
 
+#include <beman/any_view/pushdown.hpp>
+
 #include <benchmark/benchmark.h>
 
 constexpr auto max_size = 1 << 18;
@@ -58,6 +60,19 @@ static void BM_take_lazy(benchmark::State& state) {
     }
 }
 
+static void BM_take_pushdown(benchmark::State& state) {
+    const auto size  = state.range(0);
+    const auto begin = global_products.begin();
+
+    lazy::database db{.products = {begin, begin + size}};
+
+    for (auto _ : state) {
+        for (std::string_view name : beman::any_view::take(db.get_products({.min_quantity = 10}), 100)) {
+            use(name);
+        }
+    }
+}
+
 static void BM_take_reserved(benchmark::State& state) {
     const auto size  = state.range(0);
     const auto begin = global_products.begin();
@@ -74,6 +89,7 @@ static void BM_take_reserved(benchmark::State& state) {
 BENCHMARK(BM_take_eager)->RangeMultiplier(2)->Range(1 << 10, max_size);
 BENCHMARK(BM_take_fused)->RangeMultiplier(2)->Range(1 << 10, max_size);
 BENCHMARK(BM_take_lazy)->RangeMultiplier(2)->Range(1 << 10, max_size);
+BENCHMARK(BM_take_pushdown)->RangeMultiplier(2)->Range(1 << 10, max_size);
 BENCHMARK(BM_take_reserved)->RangeMultiplier(2)->Range(1 << 10, max_size);
 
 BENCHMARK_MAIN();
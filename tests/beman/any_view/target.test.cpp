@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/target.hpp>
+
+#include <gtest/gtest.h>
+
+#include <span>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::target;
+using beman::any_view::visit_as;
+using enum beman::any_view::any_view_options;
+
+TEST(TargetTest, view) {
+    std::vector<int> vec{1, 2, 3};
+    any_view<int>    view{std::span{vec}};
+
+    ASSERT_NE(target<std::span<int>>(view), nullptr);
+    EXPECT_EQ(target<std::span<int>>(view)->data(), vec.data());
+    EXPECT_EQ(target<std::span<const int>>(view), nullptr);
+    EXPECT_EQ(target<std::ranges::ref_view<std::vector<int>>>(view), nullptr);
+}
+
+TEST(TargetTest, range) {
+    std::vector<int> vec{1, 2, 3};
+    any_view<int>    borrowed{vec};
+    any_view<int>    owned{std::vector{4, 5}};
+
+    EXPECT_EQ(target<std::vector<int>>(borrowed), &vec);
+    EXPECT_EQ(target<std::ranges::ref_view<std::vector<int>>>(borrowed)->data(), vec.data());
+
+    ASSERT_NE(target<std::vector<int>>(owned), nullptr);
+    EXPECT_EQ(*target<std::vector<int>>(owned), (std::vector{4, 5}));
+}
+
+TEST(TargetTest, const_view) {
+    std::vector<int>    vec{1, 2, 3};
+    const any_view<int> view{vec};
+
+    static_assert(std::same_as<decltype(target<std::vector<int>>(view)), const std::vector<int>*>);
+    EXPECT_EQ(target<std::vector<int>>(view), &vec);
+}
+
+TEST(TargetTest, default_construct) {
+    any_view<int> view;
+
+    EXPECT_EQ(target<std::vector<int>>(view), nullptr);
+    EXPECT_EQ(target<std::span<int>>(view), nullptr);
+}
+
+TEST(TargetTest, visit_as) {
+    std::vector<int> vec{1, 2, 3};
+    std::vector<int> other{4, 5};
+
+    const auto sum = [](auto& view) -> std::string {
+        int total = 0;
+        for (const int value : view) {
+            total += value;
+        }
+        return std::string{typeid(view).name()} + "=" + std::to_string(total);
+    };
+
+    any_view<const int, forward> vector_view{vec};
+    any_view<const int, forward> span_view{std::span<const int>{other}};
+    any_view<const int, forward> reverse_view{vec | std::views::reverse};
+
+    using std::span;
+    using std::vector;
+
+    EXPECT_EQ((visit_as<vector<int>, span<const int>>(vector_view, sum)),
+              std::string{typeid(vector<int>).name()} + "=6");
+    EXPECT_EQ((visit_as<vector<int>, span<const int>>(span_view, sum)),
+              std::string{typeid(span<const int>).name()} + "=9");
+    EXPECT_EQ((visit_as<vector<int>, span<const int>>(reverse_view, sum)),
+              std::string{typeid(any_view<const int, forward>).name()} + "=6");
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/to.hpp>
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <list>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using beman::any_view::any_view;
+using beman::any_view::copy_to;
+using beman::any_view::move_to;
+using beman::any_view::to;
+using enum beman::any_view::any_view_options;
+
+constexpr auto sum(any_view<const int> view) {
+    auto result = 0;
+
+    for (const int value : to<std::vector<int>>(view)) {
+        result += value;
+    }
+
+    return result;
+}
+
+TEST(ToTest, sum_vector) {
+#ifndef _MSC_VER
+    // error C2131: expression did not evaluate to a constant
+    static_assert(15 == sum(std::vector{1, 2, 3, 4, 5}));
+#endif
+    EXPECT_EQ(15, sum(std::vector{1, 2, 3, 4, 5}));
+}
+
+TEST(ToTest, default_construct) {
+    EXPECT_TRUE(to<std::vector<int>>(any_view<int>{}).empty());
+}
+
+TEST(ToTest, reserve_exact) {
+    const auto vec = to<std::vector<int>>(any_view<int, forward, int>{std::views::iota(0, 1000)});
+
+    EXPECT_EQ(vec.size(), 1000);
+    EXPECT_EQ(vec.capacity(), 1000);
+    EXPECT_EQ(vec.back(), 999);
+}
+
+TEST(ToTest, contiguous) {
+    std::vector<int> vec{1, 2, 3};
+
+    EXPECT_EQ(to<std::vector<int>>(any_view<int>{vec}), vec);
+    EXPECT_EQ(to<std::deque<int>>(any_view<const int>{vec}), (std::deque{1, 2, 3}));
+    EXPECT_EQ(to<std::set<int>>(any_view<int, forward>{std::vector{3, 1, 2}}), (std::set{1, 2, 3}));
+}
+
+TEST(ToTest, copy_to) {
+    std::list<std::string> list{"b", "c"};
+    std::vector<std::string> result{"a"};
+
+    copy_to(any_view<std::string, bidirectional>{list}, result);
+
+    EXPECT_EQ(result, (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(list, (std::list<std::string>{"b", "c"}));
+}
+
+TEST(ToTest, move_to) {
+    std::vector<std::unique_ptr<int>> vec;
+    vec.push_back(std::make_unique<int>(1));
+    vec.push_back(std::make_unique<int>(2));
+
+    std::vector<std::unique_ptr<int>> result;
+    move_to(any_view<std::unique_ptr<int>>{vec}, result);
+
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(*result[0], 1);
+    EXPECT_EQ(*result[1], 2);
+    EXPECT_EQ(vec[0], nullptr);
+}
+
+TEST(ToTest, filter_transform) {
+    auto pipeline = std::views::iota(0, 10) | std::views::filter([](int n) { return n % 2 == 0; }) |
+                    std::views::transform([](int n) { return std::to_string(n); });
+
+    EXPECT_EQ(to<std::vector<std::string>>(any_view<std::string, input, std::string>{pipeline}),
+              (std::vector<std::string>{"0", "2", "4", "6", "8"}));
+}
+
+TEST(ToTest, input) {
+    std::istringstream in{"1 2 3 4"};
+
+    EXPECT_EQ(to<std::vector<int>>(any_view<int>{std::views::istream<int>(in)}), (std::vector{1, 2, 3, 4}));
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/any_view/spill.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using beman::any_view::any_view;
+using enum beman::any_view::any_view_options;
+
+constexpr auto max_size = 1 << 14;
+
+using any_forward_view = any_view<const int, forward>;
+
+const auto global_values = [] {
+    std::vector<int> values(max_size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}();
+
+const auto global_array = [] {
+    std::array<int, max_size> values{};
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}();
+
+template <class... Ts>
+constexpr std::size_t distinct_count = 0;
+
+template <class T, class... Ts>
+constexpr std::size_t distinct_count<T, Ts...> = distinct_count<Ts...> + ((std::is_same_v<T, Ts> or ...) ? 0 : 1);
+
+// number of distinct iterator witness tables among the erased views of RangeTs, each with its own functions
+template <class... RangeTs>
+constexpr std::size_t iterator_witness_count = distinct_count<beman::any_view::detail::iterator_adaptor_t<
+    beman::any_view::detail::erased_adaptor_t<any_forward_view, RangeTs>>...>;
+
+// iterates in turn over views of the same elements that erase different types, so that each type brings its own
+// witnesses and functions into the instruction cache unless they are shared
+static void BM_interleaved(benchmark::State& state) {
+    const auto size  = static_cast<std::size_t>(state.range(0));
+    const auto first = global_values.begin();
+    const auto last  = first + static_cast<std::ptrdiff_t>(size);
+
+    const auto values = std::vector<int>(first, last);
+    auto       span   = std::span(global_array).first(size);
+    auto       vector = std::ranges::subrange(first, last);
+    auto       array  = std::ranges::subrange(global_array.data(), global_array.data() + size);
+
+    using vector_type = const std::vector<int>&;
+    using span_type   = decltype(span);
+    using take_type   = decltype(global_values | std::views::take(size));
+    using drop_type   = decltype(global_values | std::views::drop(max_size - size));
+
+    std::array views{
+        any_forward_view{values},
+        any_forward_view{span},
+        any_forward_view{vector},
+        any_forward_view{array},
+        any_forward_view{global_values | std::views::take(size)},
+        any_forward_view{global_values | std::views::drop(max_size - size)},
+    };
+    benchmark::DoNotOptimize(views);
+
+    for (auto _ : state) {
+        auto sum = 0;
+
+        for (auto& view : views) {
+            for (const int value : view) {
+                sum += value;
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.counters["iterator_witnesses"] = static_cast<double>(
+        iterator_witness_count<vector_type, span_type, decltype(vector), decltype(array), take_type, drop_type>);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * views.size() * size));
+}
+
+BENCHMARK(BM_interleaved)->RangeMultiplier(8)->Range(1 << 5, max_size);
+
+BENCHMARK_MAIN();